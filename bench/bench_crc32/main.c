@@ -0,0 +1,530 @@
+/**
+ * \file bench_crc32/main.c
+ *
+ * \brief Benchmark every CRC kernel over a sweep of sizes, alignments, and
+ * cache states.
+ *
+ * \note Results are written to standard output as JSON. Each result reports
+ * throughput in GB/s and cost in cycles per byte. On x86-64, cycles are
+ * time stamp counter cycles, which tick at a fixed reference frequency rather
+ * than the core clock.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <libfat32/crc.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/crc/crc32_internal.h"
+
+#if defined(__x86_64__)
+# include <x86intrin.h>
+#endif
+
+#define BENCH_MIN_SIZE 16
+#define BENCH_MAX_SIZE (1024UL * 1024UL * 1024UL)
+#define BENCH_SIZE_STEP 4
+#define BENCH_MAX_OFFSET 64
+#define BENCH_EVICT_SIZE (256UL * 1024UL * 1024UL)
+#define BENCH_DEFAULT_MIN_TIME 0.05
+#define BENCH_MULTI_BUFFERS 16
+
+/**
+ * \brief A kernel under test.
+ */
+typedef struct bench_kernel bench_kernel;
+
+struct bench_kernel
+{
+    const char* name;
+    FAT32_SYM(crc32_kernel_fn) fn;
+    uint32_t required_features;
+};
+
+/**
+ * \brief Options for a benchmark run.
+ */
+typedef struct bench_options bench_options;
+
+struct bench_options
+{
+    size_t max_size;
+    double min_time;
+    const char* kernel;
+};
+
+/* the destination for the fused copy kernel. */
+static uint8_t* copy_destination = NULL;
+
+/* forward decls. */
+static uint32_t parallel_kernel(uint32_t crc, const void* data, size_t size);
+static uint32_t copy_kernel(uint32_t crc, const void* data, size_t size);
+static uint32_t multi_kernel(uint32_t crc, const void* data, size_t size);
+static int parse_options(bench_options* options, int argc, char* argv[]);
+static uint8_t* allocate_buffer(size_t* size);
+static void run_kernel(
+    const bench_kernel* kernel, const bench_options* options, uint8_t* buffer,
+    size_t buffer_size, uint8_t* evict, size_t evict_size, bool* first);
+static void emit_result(
+    bool* first, const char* kernel, size_t size, size_t offset,
+    const char* cache, size_t iterations, double seconds, uint64_t cycles);
+static void evict_input(
+    const uint8_t* data, size_t size, uint8_t* evict, size_t evict_size);
+static double now(void);
+static uint64_t cycles(void);
+
+/* the offsets from a cache line at which each size is measured. */
+static const size_t offsets[] = { 0, 1, 3, 8, 33 };
+
+/* the kernels offered by this library. */
+static const bench_kernel kernels[] = {
+    { "crc32", &FAT32_SYM(crc32_kernel), 0 },
+    { "crc32_parallel", &parallel_kernel, 0 },
+    { "crc32_copy", &copy_kernel, 0 },
+    { "crc32_multi", &multi_kernel, 0 },
+    { "crc32_bytewise", &FAT32_SYM(crc32_kernel_bytewise), 0 },
+    { "crc32_slice16", &FAT32_SYM(crc32_kernel_slice16), 0 },
+#if defined(__x86_64__)
+    { "crc32_pclmul", &FAT32_SYM(crc32_kernel_pclmul),
+      FAT32_CPU_FEATURE_PCLMUL },
+    { "crc32_vpclmul", &FAT32_SYM(crc32_kernel_vpclmul),
+      FAT32_CPU_FEATURE_PCLMUL | FAT32_CPU_FEATURE_AVX512
+    | FAT32_CPU_FEATURE_VPCLMUL },
+#endif
+    { "crc32c", &FAT32_SYM(crc32c_kernel), 0 },
+    { "crc32c_slice16", &FAT32_SYM(crc32c_kernel_slice16), 0 },
+#if defined(__x86_64__)
+    { "crc32c_sse42", &FAT32_SYM(crc32c_kernel_sse42),
+      FAT32_CPU_FEATURE_SSE42 | FAT32_CPU_FEATURE_PCLMUL },
+#endif
+};
+
+/**
+ * \brief Entry point for the CRC benchmark.
+ *
+ * \note Options are --max-size=BYTES, --min-time=SECONDS, and --kernel=NAME.
+ *
+ * \param argc      Argument count.
+ * \param argv      Argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    bench_options options;
+    bool first = true;
+
+    if (0 != parse_options(&options, argc, argv))
+    {
+        return 1;
+    }
+
+    /* allocate the buffer, reducing the maximum size if memory is short. */
+    size_t buffer_size = options.max_size + BENCH_MAX_OFFSET;
+    uint8_t* buffer = allocate_buffer(&buffer_size);
+    if (NULL == buffer)
+    {
+        fprintf(stderr, "Could not allocate a benchmark buffer.\n");
+        return 2;
+    }
+
+    /* fill the buffer so that every page is backed before timing. */
+    for (size_t i = 0; i < buffer_size; ++i)
+    {
+        buffer[i] = (uint8_t)(i * 2654435761U >> 13);
+    }
+
+    /* the eviction buffer displaces the input from cache for cold runs. */
+    size_t evict_size = BENCH_EVICT_SIZE;
+    uint8_t* evict = allocate_buffer(&evict_size);
+    if (NULL == evict)
+    {
+        fprintf(stderr, "Could not allocate an eviction buffer.\n");
+        free(buffer);
+        return 2;
+    }
+
+    memset(evict, 0x5a, evict_size);
+
+    /* the fused copy kernel writes to a destination as large as the input. */
+    copy_destination = (uint8_t*)aligned_alloc(64, buffer_size);
+    if (NULL == copy_destination)
+    {
+        fprintf(stderr, "Could not allocate a copy destination buffer.\n");
+        free(evict);
+        free(buffer);
+        return 2;
+    }
+
+    memset(copy_destination, 0, buffer_size);
+
+    uint32_t features = FAT32_SYM(cpu_features)();
+    printf("{\n  \"host\": {\n");
+    printf(
+        "    \"pclmul\": %s,\n    \"avx512\": %s,\n    \"vpclmul\": %s,\n"
+        "    \"sse42\": %s\n  },\n",
+        (features & FAT32_CPU_FEATURE_PCLMUL) ? "true" : "false",
+        (features & FAT32_CPU_FEATURE_AVX512) ? "true" : "false",
+        (features & FAT32_CPU_FEATURE_VPCLMUL) ? "true" : "false",
+        (features & FAT32_CPU_FEATURE_SSE42) ? "true" : "false");
+    printf("  \"results\": [");
+
+    for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); ++i)
+    {
+        const bench_kernel* kernel = &kernels[i];
+
+        /* skip kernels that weren't requested or that this host can't run. */
+        if (NULL != options.kernel && 0 != strcmp(options.kernel, kernel->name))
+        {
+            continue;
+        }
+
+        if (
+            kernel->required_features
+                != (features & kernel->required_features))
+        {
+            continue;
+        }
+
+        run_kernel(
+            kernel, &options, buffer, buffer_size - BENCH_MAX_OFFSET, evict,
+            evict_size, &first);
+    }
+
+    printf("\n  ]\n}\n");
+
+    free(copy_destination);
+    free(evict);
+    free(buffer);
+
+    return 0;
+}
+
+/**
+ * \brief Adapt \ref crc32_parallel to the kernel interface.
+ *
+ * \param crc           The raw CRC-32 register, which must be the initial one.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the raw CRC-32 register.
+ */
+static uint32_t parallel_kernel(uint32_t crc, const void* data, size_t size)
+{
+    (void)crc;
+
+    return FAT32_SYM(crc32_parallel)(data, size, 0) ^ 0xffffffff;
+}
+
+/**
+ * \brief Adapt \ref crc32_copy to the kernel interface.
+ *
+ * \note The copy is written to the start of the destination buffer.
+ *
+ * \param crc           The raw CRC-32 register, which must be the initial one.
+ * \param data          Data array to copy and CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the raw CRC-32 register.
+ */
+static uint32_t copy_kernel(uint32_t crc, const void* data, size_t size)
+{
+    (void)crc;
+
+    return FAT32_SYM(crc32_copy)(copy_destination, data, size) ^ 0xffffffff;
+}
+
+/**
+ * \brief Adapt \ref crc32_multi to the kernel interface.
+ *
+ * \note The input is split into BENCH_MULTI_BUFFERS equal buffers, with any
+ * remainder in the last one, so results report the total throughput over all
+ * buffers. Each buffer is 1/16 of the size, so the 4 KiB point is where the
+ * buffers reach FAT32_CRC32_MULTI_THRESHOLD.
+ *
+ * \param crc           The raw CRC-32 register, which must be the initial one.
+ * \param data          Data array to split and CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the raw CRC-32 registers of the buffers, folded together.
+ */
+static uint32_t multi_kernel(uint32_t crc, const void* data, size_t size)
+{
+    const void* bufs[BENCH_MULTI_BUFFERS];
+    size_t sizes[BENCH_MULTI_BUFFERS];
+    uint32_t out[BENCH_MULTI_BUFFERS];
+    size_t each = size / BENCH_MULTI_BUFFERS;
+    uint32_t folded = 0;
+
+    (void)crc;
+
+    for (size_t i = 0; i < BENCH_MULTI_BUFFERS; ++i)
+    {
+        bufs[i] = (const uint8_t*)data + i * each;
+        sizes[i] = each;
+    }
+
+    sizes[BENCH_MULTI_BUFFERS - 1] += size % BENCH_MULTI_BUFFERS;
+
+    FAT32_SYM(crc32_multi)(bufs, sizes, out, BENCH_MULTI_BUFFERS);
+
+    /* fold the results so that none of them can be optimized away. */
+    for (size_t i = 0; i < BENCH_MULTI_BUFFERS; ++i)
+    {
+        folded ^= out[i] ^ 0xffffffff;
+    }
+
+    return folded;
+}
+
+/**
+ * \brief Parse the command-line options.
+ *
+ * \param options   The options to populate.
+ * \param argc      Argument count.
+ * \param argv      Argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int parse_options(bench_options* options, int argc, char* argv[])
+{
+    options->max_size = BENCH_MAX_SIZE;
+    options->min_time = BENCH_DEFAULT_MIN_TIME;
+    options->kernel = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strncmp(argv[i], "--max-size=", 11))
+        {
+            options->max_size = strtoull(argv[i] + 11, NULL, 0);
+        }
+        else if (0 == strncmp(argv[i], "--min-time=", 11))
+        {
+            options->min_time = strtod(argv[i] + 11, NULL);
+        }
+        else if (0 == strncmp(argv[i], "--kernel=", 9))
+        {
+            options->kernel = argv[i] + 9;
+        }
+        else
+        {
+            fprintf(
+                stderr,
+                "Usage: %s [--max-size=BYTES] [--min-time=SECONDS] "
+                "[--kernel=NAME]\n",
+                argv[0]);
+            return 1;
+        }
+    }
+
+    if (options->max_size < BENCH_MIN_SIZE)
+    {
+        options->max_size = BENCH_MIN_SIZE;
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Allocate a cache line aligned buffer, halving the size until the
+ * allocation succeeds.
+ *
+ * \param size      The requested size, updated to the allocated size.
+ *
+ * \returns the buffer, or NULL if even a small buffer can't be allocated.
+ */
+static uint8_t* allocate_buffer(size_t* size)
+{
+    while (*size >= BENCH_MIN_SIZE + BENCH_MAX_OFFSET)
+    {
+        size_t rounded = (*size + 63) & ~(size_t)63;
+        uint8_t* buffer = (uint8_t*)aligned_alloc(64, rounded);
+        if (NULL != buffer)
+        {
+            *size = rounded;
+            return buffer;
+        }
+
+        *size /= 2;
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Measure one kernel over the size, alignment, and cache sweep.
+ *
+ * \param kernel        The kernel to measure.
+ * \param options       The benchmark options.
+ * \param buffer        The input buffer.
+ * \param buffer_size   The largest size that can be measured at any offset.
+ * \param evict         The eviction buffer.
+ * \param evict_size    The size of the eviction buffer.
+ * \param first         Whether the next result is the first.
+ */
+static void run_kernel(
+    const bench_kernel* kernel, const bench_options* options, uint8_t* buffer,
+    size_t buffer_size, uint8_t* evict, size_t evict_size, bool* first)
+{
+    volatile uint32_t sink = 0;
+
+    for (size_t size = BENCH_MIN_SIZE;
+         size <= options->max_size && size <= buffer_size;
+         size *= BENCH_SIZE_STEP)
+    {
+        for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); ++o)
+        {
+            const uint8_t* data = buffer + offsets[o];
+            size_t iterations = 0;
+            double seconds = 0.0;
+            uint64_t elapsed_cycles = 0;
+
+            /* warm: repeat over the same input once it is in cache, reading
+             * the clock between doubling batches. */
+            sink ^= kernel->fn(0xffffffff, data, size);
+            double start = now();
+            uint64_t start_cycles = cycles();
+            for (size_t batch = 1; seconds < options->min_time; batch *= 2)
+            {
+                for (size_t i = 0; i < batch; ++i)
+                {
+                    sink ^= kernel->fn(0xffffffff, data, size);
+                }
+
+                iterations += batch;
+                seconds = now() - start;
+            }
+            elapsed_cycles = cycles() - start_cycles;
+
+            emit_result(
+                first, kernel->name, size, offsets[o], "warm", iterations,
+                seconds, elapsed_cycles);
+
+            /* cold: evict the input before each run; only the run is timed. */
+            iterations = 0;
+            seconds = 0.0;
+            elapsed_cycles = 0;
+            do
+            {
+                evict_input(data, size, evict, evict_size);
+
+                start = now();
+                start_cycles = cycles();
+                sink ^= kernel->fn(0xffffffff, data, size);
+                elapsed_cycles += cycles() - start_cycles;
+                seconds += now() - start;
+                ++iterations;
+            } while (seconds < options->min_time && iterations < 16);
+
+            emit_result(
+                first, kernel->name, size, offsets[o], "cold", iterations,
+                seconds, elapsed_cycles);
+        }
+    }
+
+    (void)sink;
+}
+
+/**
+ * \brief Write a single result as a JSON object.
+ *
+ * \param first         Whether this is the first result, updated to false.
+ * \param kernel        The name of the kernel.
+ * \param size          The input size in bytes.
+ * \param offset        The offset of the input from a cache line.
+ * \param cache         The cache state, warm or cold.
+ * \param iterations    The number of timed iterations.
+ * \param seconds       The total time of these iterations.
+ * \param cycles        The total cycles of these iterations.
+ */
+static void emit_result(
+    bool* first, const char* kernel, size_t size, size_t offset,
+    const char* cache, size_t iterations, double seconds, uint64_t cycles)
+{
+    double bytes = (double)size * (double)iterations;
+
+    printf(
+        "%s\n    {\"kernel\": \"%s\", \"size\": %zu, \"offset\": %zu, "
+        "\"cache\": \"%s\", \"iterations\": %zu, \"gbps\": %.3f, "
+        "\"cycles_per_byte\": %.4f}",
+        *first ? "" : ",", kernel, size, offset, cache, iterations,
+        (seconds > 0.0) ? bytes / seconds / 1e9 : 0.0,
+        (double)cycles / bytes);
+    fflush(stdout);
+
+    *first = false;
+}
+
+/**
+ * \brief Evict an input from the cache.
+ *
+ * \note On x86-64, the input's cache lines are flushed directly. Elsewhere,
+ * the eviction buffer is written to displace the input.
+ *
+ * \param data          The input to evict.
+ * \param size          The size of the input.
+ * \param evict         The eviction buffer.
+ * \param evict_size    The size of the eviction buffer.
+ */
+static void evict_input(
+    const uint8_t* data, size_t size, uint8_t* evict, size_t evict_size)
+{
+#if defined(__x86_64__)
+    (void)evict;
+    (void)evict_size;
+
+    for (size_t i = 0; i < size; i += 64)
+    {
+        _mm_clflush(data + i);
+    }
+
+    _mm_clflush(data + size - 1);
+    _mm_mfence();
+#else
+    (void)data;
+    (void)size;
+
+    for (size_t i = 0; i < evict_size; i += 64)
+    {
+        evict[i] += 1;
+    }
+#endif
+}
+
+/**
+ * \brief Get a monotonic time stamp.
+ *
+ * \returns the time in seconds.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * \brief Get a cycle count.
+ *
+ * \note On hosts without a cycle counter, this returns nanoseconds.
+ *
+ * \returns the cycle count.
+ */
+static uint64_t cycles(void)
+{
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    return (uint64_t)(now() * 1e9);
+#endif
+}
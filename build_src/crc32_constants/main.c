@@ -1,7 +1,7 @@
 /**
  * \file crc32_constants/main.c
  *
- * \brief Build the constants for the crc32 function.
+ * \brief Build the constants for a reflected CRC-32 function.
  *
  * \copyright 2025 Justin Handville.  Please see license.txt in this
  * distribution for the license terms under which this software is distributed.
@@ -9,26 +9,69 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 
-#define CRC32_POLYNOMIAL 0xedb88320L
+#define CRC32_DEFAULT_POLYNOMIAL 0xedb88320L
+#define CRC32_DEFAULT_PREFIX "crc32"
+#define CRC32_SLICE_TABLES 16
+#define CRC32_X2N_ENTRIES 32
+
+/* the bit-reflected polynomial for which tables are generated. */
+static uint32_t polynomial = CRC32_DEFAULT_POLYNOMIAL;
+
+/* forward decls. */
+static void build_byte_table(uint32_t* table);
+static void build_slice_tables(uint32_t tables[][256], size_t count);
+static void emit_table(FILE* out, const uint32_t* table, const char* indent);
+static uint32_t multmodp(uint32_t a, uint32_t b);
+static void build_x2n_table(uint32_t* table, size_t count);
 
 /**
  * \brief Entry point for CRC-32 constants generator.
  *
- * \param argc      Argument count (unused).
- * \param argv      Argument vector (unused).
+ * \note The generator takes the output filename, optionally followed by the
+ * bit-reflected polynomial and the symbol prefix for the emitted tables. By
+ * default, it emits the RFC 1952 tables with the crc32 prefix. Only the default
+ * CRC-32 has a combine, so only it gets the zero operator table.
+ *
+ * \param argc      Argument count.
+ * \param argv      Argument vector.
  *
  * \returns 0 on success and non-zero on failure.
  */
 int main(int argc, char* argv[])
 {
-    /* verify that we have an output file. */
-    if (argc != 2)
+    uint32_t slice_tables[CRC32_SLICE_TABLES][256];
+    uint32_t x2n_table[CRC32_X2N_ENTRIES];
+    const char* prefix = CRC32_DEFAULT_PREFIX;
+    int emit_x2n = 1;
+
+    /* verify that we have an output file, and optionally a polynomial. */
+    if (argc != 2 && argc != 4)
     {
-        fprintf(stderr, "Expecting one argument, the output filename.\n");
+        fprintf(
+            stderr,
+            "Usage: %s output [polynomial prefix]\n",
+            argv[0]);
         return 1;
     }
 
+    /* parse the polynomial and prefix. */
+    if (4 == argc)
+    {
+        char* end;
+        unsigned long value = strtoul(argv[2], &end, 0);
+        if ('\0' != *end || 0 == value || value > 0xffffffffUL)
+        {
+            fprintf(stderr, "Invalid polynomial %s.\n", argv[2]);
+            return 1;
+        }
+
+        polynomial = (uint32_t)value;
+        prefix = argv[3];
+        emit_x2n = 0;
+    }
+
     /* open the output file for writing. */
     FILE* out = fopen(argv[1], "w");
     if (NULL == out)
@@ -37,22 +80,73 @@ int main(int argc, char* argv[])
         return 2;
     }
 
+    /* build the byte table and the slicing tables derived from it. */
+    build_byte_table(slice_tables[0]);
+    build_slice_tables(slice_tables, CRC32_SLICE_TABLES);
+
+    /* build the zero operator table used to combine CRCs. */
+    if (emit_x2n)
+    {
+        build_x2n_table(x2n_table, CRC32_X2N_ENTRIES);
+    }
+
     /* front matter. */
     fprintf(out, "#include <libfat32/crc.h>\n\n");
 
-    /* begin the constant array. */
-    fprintf(out, "const uint32_t FAT32_SYM(crc32_constants)[256] = {");
+    /* emit the byte-at-a-time constant array. */
+    fprintf(out, "const uint32_t FAT32_SYM(%s_constants)[256] = {", prefix);
+    emit_table(out, slice_tables[0], "    ");
+    fprintf(out, "\n};\n\n");
 
-    for (uint32_t i = 0; i < 256; ++i)
+    /* emit the slicing constant arrays. */
+    fprintf(
+        out,
+        "const uint32_t FAT32_SYM(%s_slice_constants)[%d][256] = {",
+        prefix, CRC32_SLICE_TABLES);
+    for (size_t i = 0; i < CRC32_SLICE_TABLES; ++i)
     {
-        /* the CRC constant starts with the byte. */
-        uint32_t c = i;
+        fprintf(out, "\n    {");
+        emit_table(out, slice_tables[i], "        ");
+        fprintf(out, "\n    },");
+    }
+    fprintf(out, "\n};\n");
 
-        /* ensure that the constants respect the 80 column rule. */
-        if (0 == (i % 6))
+    /* emit the zero operator array. */
+    if (emit_x2n)
+    {
+        fprintf(
+            out, "\nconst uint32_t FAT32_SYM(%s_x2n_constants)[%d] = {",
+            prefix, CRC32_X2N_ENTRIES);
+        for (size_t i = 0; i < CRC32_X2N_ENTRIES; ++i)
         {
-            fprintf(out, "\n    ");
+            /* ensure that the constants respect the 80 column rule. */
+            if (0 == (i % 6))
+            {
+                fprintf(out, "\n    ");
+            }
+
+            fprintf(out, "0x%08x, ", x2n_table[i]);
         }
+        fprintf(out, "\n};\n");
+    }
+
+    /* close the output file. */
+    fclose(out);
+
+    return 0;
+}
+
+/**
+ * \brief Build the byte-at-a-time CRC-32 table.
+ *
+ * \param table         The 256 entry table to populate.
+ */
+static void build_byte_table(uint32_t* table)
+{
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        /* the CRC constant starts with the byte. */
+        uint32_t c = i;
 
         /* iterate over each bit. */
         for (uint32_t k = 0; k < 8; ++k)
@@ -60,7 +154,7 @@ int main(int argc, char* argv[])
             /* if the bit is set, xor in the CRC polynomial. */
             if (c & 1)
             {
-                c = CRC32_POLYNOMIAL ^ (c >> 1);
+                c = polynomial ^ (c >> 1);
             }
             /* otherwise, shift this constant down by one. */
             else
@@ -69,15 +163,109 @@ int main(int argc, char* argv[])
             }
         }
 
+        table[i] = c;
+    }
+}
+
+/**
+ * \brief Build the slicing tables from the byte table.
+ *
+ * \note Table k holds the CRC contribution of a byte followed by k zero bytes,
+ * which lets a kernel fold k + 1 bytes with independent table lookups. Table 0
+ * must already hold the byte table.
+ *
+ * \param tables        The tables to populate.
+ * \param count         The number of tables to populate.
+ */
+static void build_slice_tables(uint32_t tables[][256], size_t count)
+{
+    for (size_t k = 1; k < count; ++k)
+    {
+        for (size_t i = 0; i < 256; ++i)
+        {
+            /* run the previous table's entry through one more zero byte. */
+            uint32_t c = tables[k - 1][i];
+            tables[k][i] = tables[0][c & 0xFF] ^ (c >> 8);
+        }
+    }
+}
+
+/**
+ * \brief Emit the body of a 256 entry table.
+ *
+ * \param out           The output file.
+ * \param table         The table to emit.
+ * \param indent        The indentation for each line of constants.
+ */
+static void emit_table(FILE* out, const uint32_t* table, const char* indent)
+{
+    for (size_t i = 0; i < 256; ++i)
+    {
+        /* ensure that the constants respect the 80 column rule. */
+        if (0 == (i % 6))
+        {
+            fprintf(out, "\n%s", indent);
+        }
+
         /* emit the completed constant to the C source file. */
-        fprintf(out, "0x%08x, ", c);
+        fprintf(out, "0x%08x, ", table[i]);
     }
+}
 
-    /* terminate the array. */
-    fprintf(out, "\n};\n");
+/**
+ * \brief Multiply two polynomials modulo the CRC polynomial.
+ *
+ * \note Polynomials are bit-reflected, so the most significant bit holds the
+ * coefficient of x^0.
+ *
+ * \param a             The first polynomial.
+ * \param b             The second polynomial.
+ *
+ * \returns a(x) * b(x) mod P(x).
+ */
+static uint32_t multmodp(uint32_t a, uint32_t b)
+{
+    uint32_t m = (uint32_t)1 << 31;
+    uint32_t p = 0;
 
-    /* close the output file. */
-    fclose(out);
+    for (;;)
+    {
+        /* add b(x) * x^k for each term x^k in a(x). */
+        if (a & m)
+        {
+            p ^= b;
+            if (0 == (a & (m - 1)))
+            {
+                break;
+            }
+        }
 
-    return 0;
+        /* advance b(x) to the next power of x. */
+        m >>= 1;
+        b = (b & 1) ? (polynomial ^ (b >> 1)) : (b >> 1);
+    }
+
+    return p;
+}
+
+/**
+ * \brief Build the table of zero operators.
+ *
+ * \note Entry k is x^(2^k) mod P(x), the operator that runs a CRC register
+ * through 2^k zero bits. Each entry is the square of the previous one, so this
+ * table is the repeated squaring of the single zero bit operator. Because
+ * x^(2^32) = x mod P(x), entries repeat with a period of 32.
+ *
+ * \param table         The table to populate.
+ * \param count         The number of entries to populate.
+ */
+static void build_x2n_table(uint32_t* table, size_t count)
+{
+    /* x^1. */
+    table[0] = (uint32_t)1 << 30;
+
+    for (size_t k = 1; k < count; ++k)
+    {
+        table[k] = multmodp(table[k - 1], table[k - 1]);
+    }
 }
@@ -0,0 +1,327 @@
+/**
+ * \file gpt_partition_types/main.c
+ *
+ * \brief Build the partition type registry and its perfect hash table.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../src/gpt/gpt_internal.h"
+
+/* the number of seeds to try before giving up. */
+#define SEED_ATTEMPTS 1000000
+
+/**
+ * \brief A registered partition type.
+ */
+typedef struct partition_type partition_type;
+
+struct partition_type
+{
+    FAT32_SYM(gpt_partition_type) type;
+    const char* guid;
+};
+
+/* the registry. Types are listed in enum order. */
+static const partition_type registry[] = {
+    { FAT32_GPT_PARTITION_TYPE_UNUSED,
+      "00000000-0000-0000-0000-000000000000" },
+    { FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM,
+      "C12A7328-F81F-11D2-BA4B-00A0C93EC93B" },
+    { FAT32_GPT_PARTITION_TYPE_LEGACY_MBR,
+      "024DEE41-33E7-11D3-9D69-0008C781F39F" },
+    { FAT32_GPT_PARTITION_TYPE_BIOS_BOOT,
+      "21686148-6449-6E6F-744E-656564454649" },
+    { FAT32_GPT_PARTITION_TYPE_MICROSOFT_RESERVED,
+      "E3C9E316-0B5C-4DB8-817D-F92DF00215AE" },
+    { FAT32_GPT_PARTITION_TYPE_MICROSOFT_BASIC_DATA,
+      "EBD0A0A2-B9E5-4433-87C0-68B6B72699C7" },
+    { FAT32_GPT_PARTITION_TYPE_MICROSOFT_LDM_METADATA,
+      "5808C8AA-7E8F-42E0-85D2-E1E90434CFB3" },
+    { FAT32_GPT_PARTITION_TYPE_MICROSOFT_LDM_DATA,
+      "AF9B60A0-1431-4F62-BC68-3311714A69AD" },
+    { FAT32_GPT_PARTITION_TYPE_WINDOWS_RECOVERY,
+      "DE94BBA4-06D1-4D40-A16A-BFD50179D6AC" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_FILESYSTEM,
+      "0FC63DAF-8483-4772-8E79-3D69D8477DE4" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_SWAP,
+      "0657FD6D-A4AB-43C4-84E5-0933C84B4F4F" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_LVM,
+      "E6D6D379-F507-44C2-A23C-238F2A3DF928" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_RAID,
+      "A19D880F-05FC-4D3B-A006-743F0F84911E" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_HOME,
+      "933AC7E1-2EB4-4F13-B844-0E14E2AEF915" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_SRV,
+      "3B8F8425-20E0-4F3B-907F-1A25A76F98E8" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_VAR,
+      "4D21B016-B534-45C2-A9FB-5C16E091FD2D" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_ROOT_X86_64,
+      "4F68BCE3-E8CD-4DB1-96E7-FBCAF984B709" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_ROOT_ARM64,
+      "B921B045-1DF0-41C3-AF44-4C6F280D3FAE" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_USR_X86_64,
+      "8484680C-9521-48C6-9C11-B0720656F69E" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_USR_ARM64,
+      "B0E01050-EE5F-4390-949A-9101B17104E9" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_XBOOTLDR,
+      "BC13C2FF-59E6-4262-A352-B275FD6F7172" },
+    { FAT32_GPT_PARTITION_TYPE_APPLE_HFS_PLUS,
+      "48465300-0000-11AA-AA11-00306543ECAC" },
+    { FAT32_GPT_PARTITION_TYPE_APPLE_APFS,
+      "7C3457EF-0000-11AA-AA11-00306543ECAC" },
+    { FAT32_GPT_PARTITION_TYPE_FREEBSD_UFS,
+      "516E7CB6-6ECF-11D6-8FF8-00022D09712B" },
+    { FAT32_GPT_PARTITION_TYPE_CHROMEOS_KERNEL,
+      "FE3A2A5D-4F32-41A7-B725-ACCC3285A309" },
+    { FAT32_GPT_PARTITION_TYPE_CHROMEOS_ROOTFS,
+      "3CB8E202-3B7E-47DD-8A3C-7FF2A13CFCEC" },
+};
+
+#define REGISTRY_SIZE (sizeof(registry) / sizeof(registry[0]))
+
+/* forward decls. */
+static int parse_guid(uint8_t* raw, const char* str);
+static uint64_t load_little_endian(const uint8_t* bytes);
+static uint64_t next_seed(uint64_t* state);
+static int build_slots(uint8_t* slots, uint8_t raw[][16], uint64_t seed);
+static void emit_bytes(
+    FILE* out, const uint8_t* bytes, size_t size, const char* indent);
+
+/**
+ * \brief Entry point for the partition type registry generator.
+ *
+ * \param argc      Argument count.
+ * \param argv      Argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    uint8_t raw[FAT32_GPT_PARTITION_TYPE_COUNT][16];
+    uint8_t slots[FAT32_GPT_PARTITION_TYPE_SLOTS];
+    uint64_t state = 0;
+    uint64_t seed = 0;
+    int attempt;
+
+    /* verify that we have an output file. */
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s output\n", argv[0]);
+        return 1;
+    }
+
+    /* every type except unknown must be registered, in enum order. */
+    if (FAT32_GPT_PARTITION_TYPE_COUNT - 1 != REGISTRY_SIZE)
+    {
+        fprintf(stderr, "The registry doesn't cover every partition type.\n");
+        return 1;
+    }
+
+    /* the unknown type gets a guid that is never compared. */
+    memset(raw[FAT32_GPT_PARTITION_TYPE_UNKNOWN], 0xff, 16);
+
+    /* convert each guid to its on-disk form. */
+    for (size_t i = 0; i < REGISTRY_SIZE; ++i)
+    {
+        if ((int)i + 1 != (int)registry[i].type
+         || 0 != parse_guid(raw[registry[i].type], registry[i].guid))
+        {
+            fprintf(stderr, "Bad registry entry %s.\n", registry[i].guid);
+            return 1;
+        }
+    }
+
+    /* search for a seed that gives every type its own slot. */
+    for (attempt = 0; attempt < SEED_ATTEMPTS; ++attempt)
+    {
+        seed = next_seed(&state);
+        if (0 == build_slots(slots, raw, seed))
+        {
+            break;
+        }
+    }
+
+    if (SEED_ATTEMPTS == attempt)
+    {
+        fprintf(stderr, "No perfect hash seed found.\n");
+        return 1;
+    }
+
+    /* open the output file for writing. */
+    FILE* out = fopen(argv[1], "w");
+    if (NULL == out)
+    {
+        fprintf(stderr, "Could not open %s for writing.\n", argv[1]);
+        return 2;
+    }
+
+    /* front matter. */
+    fprintf(out, "#include <libfat32/gpt.h>\n\n");
+
+    /* emit the on-disk guids. */
+    fprintf(
+        out,
+        "const uint8_t FAT32_SYM(gpt_partition_type_guids)[%d][%d] = {",
+        FAT32_GPT_PARTITION_TYPE_COUNT, FAT32_GUID_BINARY_SIZE);
+    for (size_t i = 0; i < FAT32_GPT_PARTITION_TYPE_COUNT; ++i)
+    {
+        fprintf(out, "\n    {");
+        emit_bytes(out, raw[i], 16, "        ");
+        fprintf(out, "\n    },");
+    }
+    fprintf(out, "\n};\n\n");
+
+    /* emit the slots. */
+    fprintf(
+        out, "const uint8_t FAT32_SYM(gpt_partition_type_slots)[%d] = {",
+        FAT32_GPT_PARTITION_TYPE_SLOTS);
+    emit_bytes(out, slots, FAT32_GPT_PARTITION_TYPE_SLOTS, "    ");
+    fprintf(out, "\n};\n\n");
+
+    /* emit the seed. */
+    fprintf(
+        out,
+        "const uint64_t FAT32_SYM(gpt_partition_type_seed) =\n"
+        "    0x%016llxULL;\n",
+        (unsigned long long)seed);
+
+    /* close the output file. */
+    fclose(out);
+
+    return 0;
+}
+
+/**
+ * \brief Parse a canonical guid string into its on-disk form.
+ *
+ * \param raw           The 16-byte on-disk guid.
+ * \param str           The canonical guid string.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int parse_guid(uint8_t* raw, const char* str)
+{
+    /* the on-disk position of each byte of the string, in string order. */
+    static const int order[16] = {
+        3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+    unsigned int bytes[16];
+
+    if (36 != strlen(str)
+     || 16 != sscanf(
+            str,
+            "%2x%2x%2x%2x-%2x%2x-%2x%2x-%2x%2x-%2x%2x%2x%2x%2x%2x",
+            &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4],
+            &bytes[5], &bytes[6], &bytes[7], &bytes[8], &bytes[9],
+            &bytes[10], &bytes[11], &bytes[12], &bytes[13], &bytes[14],
+            &bytes[15]))
+    {
+        return 1;
+    }
+
+    for (int i = 0; i < 16; ++i)
+    {
+        raw[order[i]] = (uint8_t)bytes[i];
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Load eight bytes as a little-endian value.
+ *
+ * \param bytes         The bytes to load.
+ *
+ * \returns the value of these bytes.
+ */
+static uint64_t load_little_endian(const uint8_t* bytes)
+{
+    uint64_t retval = 0;
+
+    for (int i = 7; i >= 0; --i)
+    {
+        retval = (retval << 8) | bytes[i];
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Get the next candidate seed.
+ *
+ * \note This is splitmix64 from a fixed state, so the output is reproducible.
+ * Seeds are odd, so that the multiply keeps every bit of the key.
+ *
+ * \param state         The generator state.
+ *
+ * \returns the next seed.
+ */
+static uint64_t next_seed(uint64_t* state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+    return (z ^ (z >> 31)) | 1;
+}
+
+/**
+ * \brief Place every registered type in its slot for a seed.
+ *
+ * \param slots         The slots to populate.
+ * \param raw           The on-disk guids, indexed by type.
+ * \param seed          The seed to try.
+ *
+ * \returns 0 if every type has its own slot and non-zero on a collision.
+ */
+static int build_slots(uint8_t* slots, uint8_t raw[][16], uint64_t seed)
+{
+    memset(slots, FAT32_GPT_PARTITION_TYPE_UNKNOWN,
+        FAT32_GPT_PARTITION_TYPE_SLOTS);
+
+    for (int type = 1; type < FAT32_GPT_PARTITION_TYPE_COUNT; ++type)
+    {
+        size_t slot =
+            FAT32_GPT_PARTITION_TYPE_SLOT(
+                load_little_endian(raw[type]),
+                load_little_endian(raw[type] + 8), seed);
+
+        if (FAT32_GPT_PARTITION_TYPE_UNKNOWN != slots[slot])
+        {
+            return 1;
+        }
+
+        slots[slot] = (uint8_t)type;
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Emit an array of bytes.
+ *
+ * \param out           The output file.
+ * \param bytes         The bytes to emit.
+ * \param size          The number of bytes.
+ * \param indent        The indentation for each line of bytes.
+ */
+static void emit_bytes(
+    FILE* out, const uint8_t* bytes, size_t size, const char* indent)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        /* ensure that the bytes respect the 80 column rule. */
+        if (0 == (i % 8))
+        {
+            fprintf(out, "\n%s", indent);
+        }
+
+        fprintf(out, "0x%02x, ", bytes[i]);
+    }
+}
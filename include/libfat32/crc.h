@@ -15,6 +15,7 @@
 #include <libfat32/model_check/memory.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -26,6 +27,35 @@ extern "C" {
  */
 extern const uint32_t FAT32_SYM(crc32_constants)[256];
 
+/**
+ * \brief Slicing constants for the CRC-32 function.
+ *
+ * \note Table k holds the CRC-32 contribution of a byte followed by k zero
+ * bytes. Table 0 matches \ref crc32_constants.
+ */
+extern const uint32_t FAT32_SYM(crc32_slice_constants)[16][256];
+
+/**
+ * \brief Zero operator constants for the CRC-32 function.
+ *
+ * \note Entry k is x^(2^k) mod P(x), bit-reflected, which runs a CRC-32
+ * register through 2^k zero bits.
+ */
+extern const uint32_t FAT32_SYM(crc32_x2n_constants)[32];
+
+/**
+ * \brief Constants for the CRC-32C function.
+ */
+extern const uint32_t FAT32_SYM(crc32c_constants)[256];
+
+/**
+ * \brief Slicing constants for the CRC-32C function.
+ *
+ * \note Table k holds the CRC-32C contribution of a byte followed by k zero
+ * bytes. Table 0 matches \ref crc32c_constants.
+ */
+extern const uint32_t FAT32_SYM(crc32c_slice_constants)[16][256];
+
 /**
  * \brief Calculates the CRC-32 of a given section of memory.
  *
@@ -50,15 +80,370 @@ MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
          * postconditions to check beyond unit testing. */
 MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32))
 
+/**
+ * \brief Running state for a CRC-32 computed over several updates.
+ */
+typedef struct FAT32_SYM(crc32_state) FAT32_SYM(crc32_state);
+
+struct FAT32_SYM(crc32_state)
+{
+    uint32_t crc;
+};
+
+/**
+ * \brief Initialize a CRC-32 state.
+ *
+ * \param state         The state to initialize.
+ */
+void FAT32_SYM(crc32_init)(FAT32_SYM(crc32_state)* state);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_init), FAT32_SYM(crc32_state)* state)
+        /* state must be accessible. */
+        MODEL_CHECK_OBJECT_RW(state, sizeof(*state));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_init))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_init), FAT32_SYM(crc32_state)* state)
+        /* the state holds the initial CRC-32 register. */
+        MODEL_ASSERT(0xffffffff == state->crc);
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_init))
+
+/**
+ * \brief Add a section of memory to a CRC-32 state.
+ *
+ * \note Updating a state with several sections produces the same CRC-32 as a
+ * single call to \ref crc32 over their concatenation.
+ *
+ * \param state         The state to update.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ */
+void FAT32_SYM(crc32_update)(
+    FAT32_SYM(crc32_state)* state, const void* data, size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_update), FAT32_SYM(crc32_state)* state, const void* data,
+    size_t size)
+        /* state must be accessible. */
+        MODEL_CHECK_OBJECT_RW(state, sizeof(*state));
+        /* data must be accessible. */
+        MODEL_CHECK_OBJECT_READ(data, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_update))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_update), FAT32_SYM(crc32_state)* state, const void* data,
+    size_t size)
+        /* this function performs a computation over data. There are no
+         * postconditions to check beyond unit testing. */
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_update))
+
+/**
+ * \brief Get the CRC-32 of all sections added to a CRC-32 state.
+ *
+ * \note The state is not modified, so it can be updated further.
+ *
+ * \param state         The state to finalize.
+ *
+ * \returns the CRC-32 of the sections added to this state.
+ */
+uint32_t FAT32_SYM(crc32_final)(const FAT32_SYM(crc32_state)* state);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_final), const FAT32_SYM(crc32_state)* state)
+        /* state must be accessible. */
+        MODEL_CHECK_OBJECT_READ(state, sizeof(*state));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_final))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_final), uint32_t retval,
+    const FAT32_SYM(crc32_state)* state)
+        /* the CRC-32 is the inverted register. */
+        MODEL_ASSERT((state->crc ^ 0xffffffff) == retval);
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_final))
+
+/**
+ * \brief Calculates the CRC-32 of a vector of memory sections, in order.
+ *
+ * \param iov           The vector of memory sections to CRC.
+ * \param iovcnt        The number of memory sections in this vector.
+ *
+ * \returns the CRC-32 of the concatenation of these memory sections.
+ */
+uint32_t FAT32_SYM(crc32_iov)(const struct iovec* iov, size_t iovcnt);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_iov), const struct iovec* iov, size_t iovcnt)
+        /* iov must be accessible. */
+        MODEL_CHECK_OBJECT_READ(iov, iovcnt * sizeof(*iov));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_iov))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_iov), uint32_t retval, const struct iovec* iov,
+    size_t iovcnt)
+        /* this function performs a computation over data. There are no
+         * postconditions to check beyond unit testing. */
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_iov))
+
+/**
+ * \brief Combine the CRC-32 values of two adjacent sections of memory.
+ *
+ * \note This runs in O(log len_b) time without access to either section.
+ *
+ * \param crc_a         The CRC-32 of the first section.
+ * \param crc_b         The CRC-32 of the second section.
+ * \param len_b         The size of the second section in bytes.
+ *
+ * \returns the CRC-32 of the first section followed by the second section.
+ */
+uint32_t FAT32_SYM(crc32_combine)(
+    uint32_t crc_a, uint32_t crc_b, uint64_t len_b);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_combine), uint32_t crc_a, uint32_t crc_b, uint64_t len_b)
+        /* any CRC-32 values and length can be combined. */
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_combine))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_combine), uint32_t retval, uint32_t crc_a, uint32_t crc_b,
+    uint64_t len_b)
+        /* combining with an empty second section changes nothing. */
+        if (0 == len_b)
+        {
+            MODEL_ASSERT((crc_a ^ crc_b) == retval);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_combine))
+
+/**
+ * \brief Copy a section of memory and calculate its CRC-32 in one pass.
+ *
+ * \note This is equivalent to memcpy followed by \ref crc32 over the copy, but
+ * each byte is read from memory once. Large copies bypass the cache when
+ * writing the destination.
+ *
+ * \param dst           The destination buffer, which must not overlap src.
+ * \param src           The source buffer.
+ * \param size          The number of bytes to copy.
+ *
+ * \returns the CRC-32 of the copied bytes.
+ */
+uint32_t FAT32_SYM(crc32_copy)(void* dst, const void* src, size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_copy), void* dst, const void* src, size_t size)
+        /* dst must be accessible. */
+        MODEL_CHECK_OBJECT_WRITE(dst, size);
+        /* src must be accessible. */
+        MODEL_CHECK_OBJECT_READ(src, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_copy))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_copy), uint32_t retval, void* dst, const void* src,
+    size_t size)
+        /* this function performs a computation over data. There are no
+         * postconditions to check beyond unit testing. */
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_copy))
+
+/**
+ * \brief Update the CRC-32 of a section of memory after a sub-range of it
+ * changes.
+ *
+ * \note CRC-32 is linear, so the change in the CRC-32 depends only on the
+ * difference between the old and new bytes and on how far that difference is
+ * from the end of the section. This runs in O(n + log total_len) time without
+ * access to the rest of the section.
+ *
+ * \param old_crc       The CRC-32 of the section before the change.
+ * \param total_len     The size of the section in bytes.
+ * \param offset        The offset of the changed sub-range in the section.
+ * \param old_bytes     The bytes of the sub-range before the change.
+ * \param new_bytes     The bytes of the sub-range after the change.
+ * \param n             The size of the sub-range in bytes.
+ *
+ * \returns the CRC-32 of the section after the change.
+ */
+uint32_t FAT32_SYM(crc32_patch)(
+    uint32_t old_crc, uint64_t total_len, uint64_t offset,
+    const void* old_bytes, const void* new_bytes, size_t n);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_patch), uint32_t old_crc, uint64_t total_len,
+    uint64_t offset, const void* old_bytes, const void* new_bytes, size_t n)
+        /* the sub-range must be within the section. */
+        MODEL_ASSERT(offset <= total_len);
+        MODEL_ASSERT(n <= total_len - offset);
+        /* old_bytes must be accessible. */
+        MODEL_CHECK_OBJECT_READ(old_bytes, n);
+        /* new_bytes must be accessible. */
+        MODEL_CHECK_OBJECT_READ(new_bytes, n);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_patch))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_patch), uint32_t retval, uint32_t old_crc,
+    uint64_t total_len, uint64_t offset, const void* old_bytes,
+    const void* new_bytes, size_t n)
+        /* an empty change leaves the CRC-32 as it was. */
+        if (0 == n)
+        {
+            MODEL_ASSERT(retval == old_crc);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_patch))
+
+/**
+ * \brief Calculates the CRC-32 of a given section of memory using several
+ * threads.
+ *
+ * \note The section is split into one contiguous chunk per thread, and the
+ * chunk CRCs are merged with \ref crc32_combine. The result is identical to
+ * \ref crc32. Sections too small to benefit from threads are computed on the
+ * calling thread. If a thread can't be started, its chunk is also computed on
+ * the calling thread.
+ *
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ * \param nthreads      The maximum number of threads to use, including the
+ *                      calling thread, or 0 to use one per online CPU.
+ *
+ * \returns the CRC-32 of this section of memory.
+ */
+uint32_t FAT32_SYM(crc32_parallel)(
+    const void* data, size_t size, unsigned int nthreads);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_parallel), const void* data, size_t size,
+    unsigned int nthreads)
+        /* data must be accessible. */
+        MODEL_CHECK_OBJECT_READ(data, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_parallel))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_parallel), uint32_t retval, const void* data, size_t size,
+    unsigned int nthreads)
+        /* this function performs a computation over data. There are no
+         * postconditions to check beyond unit testing. */
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_parallel))
+
+/**
+ * \brief Calculates the CRC-32 of each of several independent sections of
+ * memory.
+ *
+ * \note Short sections are bound by the latency of the CRC-32 kernels rather
+ * than by their throughput. Sections are taken four at a time, and groups of
+ * short sections are computed together so that their dependency chains
+ * overlap. Each result is identical to \ref crc32 over its section.
+ *
+ * \param bufs          The sections to CRC.
+ * \param sizes         The size of each section.
+ * \param out           The CRC-32 of each section, on return.
+ * \param n             The number of sections.
+ */
+void FAT32_SYM(crc32_multi)(
+    const void* const* bufs, const size_t* sizes, uint32_t* out, size_t n);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32_multi), const void* const* bufs, const size_t* sizes,
+    uint32_t* out, size_t n)
+        /* bufs must be accessible. */
+        MODEL_CHECK_OBJECT_READ(bufs, n * sizeof(*bufs));
+        /* sizes must be accessible. */
+        MODEL_CHECK_OBJECT_READ(sizes, n * sizeof(*sizes));
+        /* out must be accessible. */
+        MODEL_CHECK_OBJECT_WRITE(out, n * sizeof(*out));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32_multi))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32_multi), const void* const* bufs, const size_t* sizes,
+    uint32_t* out, size_t n)
+        /* this function performs a computation over data. There are no
+         * postconditions to check beyond unit testing. */
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32_multi))
+
+/**
+ * \brief Calculates the CRC-32C of a given section of memory.
+ *
+ * \note CRC-32C uses the Castagnoli polynomial, as described in RFC 3720. It is
+ * used by iSCSI and VHDX, among others.
+ *
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the CRC-32C of this section of memory.
+ */
+uint32_t FAT32_SYM(crc32c)(const void* data, size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(crc32c), const void* data, size_t size)
+        /* data must be accessible. */
+        MODEL_CHECK_OBJECT_READ(data, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(crc32c))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(crc32c), uint32_t retval, const void* data, size_t size)
+        /* this function performs a computation over data. There are no
+         * postconditions to check beyond unit testing. */
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(crc32c))
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
 
 #define __INTERNAL_FAT32_IMPORT_crc_sym(sym) \
     FAT32_BEGIN_EXPORT \
+    typedef FAT32_SYM(crc32_state) sym ## crc32_state; \
     static inline uint32_t sym ## crc32( \
         const void* x, size_t y) { \
             return FAT32_SYM(crc32)(x,y); } \
+    static inline void sym ## crc32_init( \
+        FAT32_SYM(crc32_state)* x) { \
+            FAT32_SYM(crc32_init)(x); } \
+    static inline void sym ## crc32_update( \
+        FAT32_SYM(crc32_state)* x, const void* y, size_t z) { \
+            FAT32_SYM(crc32_update)(x,y,z); } \
+    static inline uint32_t sym ## crc32_final( \
+        const FAT32_SYM(crc32_state)* x) { \
+            return FAT32_SYM(crc32_final)(x); } \
+    static inline uint32_t sym ## crc32_iov( \
+        const struct iovec* x, size_t y) { \
+            return FAT32_SYM(crc32_iov)(x,y); } \
+    static inline uint32_t sym ## crc32_combine( \
+        uint32_t x, uint32_t y, uint64_t z) { \
+            return FAT32_SYM(crc32_combine)(x,y,z); } \
+    static inline uint32_t sym ## crc32_copy( \
+        void* x, const void* y, size_t z) { \
+            return FAT32_SYM(crc32_copy)(x,y,z); } \
+    static inline uint32_t sym ## crc32_patch( \
+        uint32_t x, uint64_t y, uint64_t z, const void* w, const void* v, \
+        size_t u) { \
+            return FAT32_SYM(crc32_patch)(x,y,z,w,v,u); } \
+    static inline uint32_t sym ## crc32_parallel( \
+        const void* x, size_t y, unsigned int z) { \
+            return FAT32_SYM(crc32_parallel)(x,y,z); } \
+    static inline void sym ## crc32_multi( \
+        const void* const* x, const size_t* y, uint32_t* z, size_t w) { \
+            FAT32_SYM(crc32_multi)(x,y,z,w); } \
+    static inline uint32_t sym ## crc32c( \
+        const void* x, size_t y) { \
+            return FAT32_SYM(crc32c)(x,y); } \
     FAT32_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define FAT32_IMPORT_crc_as(sym) \
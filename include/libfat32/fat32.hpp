@@ -0,0 +1,345 @@
+/**
+ * \file libfat32/fat32.hpp
+ *
+ * \brief C++20 compile-time helpers for libfat32.
+ *
+ * \note The constexpr functions in this header match their C counterparts, so
+ * well-known GUIDs and CRC-32 values over fixed templates can be computed and
+ * checked at compile time. At run time, they defer to the C library where it
+ * is faster.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#if !defined(__cplusplus) || __cplusplus < 202002L
+# error "libfat32/fat32.hpp requires C++20."
+#endif
+
+#include <libfat32/crc.h>
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace fat32 {
+
+using guid = FAT32_SYM(guid);
+
+namespace detail {
+
+/**
+ * \brief Build the byte-at-a-time CRC-32 table at compile time.
+ *
+ * \returns the table, which matches \ref crc32_constants.
+ */
+consteval std::array<std::uint32_t, 256> make_crc32_table()
+{
+    std::array<std::uint32_t, 256> table{};
+
+    for (std::uint32_t i = 0; i < 256; ++i)
+    {
+        std::uint32_t c = i;
+
+        for (int k = 0; k < 8; ++k)
+        {
+            c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+        }
+
+        table[i] = c;
+    }
+
+    return table;
+}
+
+inline constexpr std::array<std::uint32_t, 256> crc32_table =
+    make_crc32_table();
+
+/**
+ * \brief Update a raw CRC-32 register one byte at a time.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          The bytes to CRC.
+ * \param size          The number of bytes.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+template <typename T>
+constexpr std::uint32_t crc32_bytewise(
+    std::uint32_t crc, const T* data, std::size_t size) noexcept
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc =
+            crc32_table[(crc ^ static_cast<std::uint8_t>(data[i])) & 0xFF]
+          ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+/**
+ * \brief Convert a hex digit to its value.
+ *
+ * \param ch            The character to convert.
+ *
+ * \returns the value of this digit, or -1 if it is not a hex digit.
+ */
+constexpr int hex_value(char ch) noexcept
+{
+    if (ch >= '0' && ch <= '9')
+    {
+        return ch - '0';
+    }
+    else if (ch >= 'A' && ch <= 'F')
+    {
+        return ch - 'A' + 10;
+    }
+    else if (ch >= 'a' && ch <= 'f')
+    {
+        return ch - 'a' + 10;
+    }
+
+    return -1;
+}
+
+} /* namespace detail */
+
+/**
+ * \brief Calculates the CRC-32 of a given section of memory.
+ *
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the CRC-32 of this section of memory.
+ */
+constexpr std::uint32_t crc32(const std::uint8_t* data, std::size_t size)
+{
+    if (std::is_constant_evaluated())
+    {
+        return detail::crc32_bytewise(0xffffffff, data, size) ^ 0xffffffff;
+    }
+
+    return FAT32_SYM(crc32)(data, size);
+}
+
+/**
+ * \brief Calculates the CRC-32 of a byte array.
+ *
+ * \param data          Data array to CRC.
+ *
+ * \returns the CRC-32 of this array.
+ */
+template <std::size_t N>
+constexpr std::uint32_t crc32(const std::array<std::uint8_t, N>& data)
+{
+    return crc32(data.data(), N);
+}
+
+/**
+ * \brief Calculates the CRC-32 of the characters of a string.
+ *
+ * \note For a string literal, the terminating NUL is not included.
+ *
+ * \param str           The string to CRC.
+ *
+ * \returns the CRC-32 of this string.
+ */
+constexpr std::uint32_t crc32(std::string_view str)
+{
+    if (std::is_constant_evaluated())
+    {
+        return
+            detail::crc32_bytewise(0xffffffff, str.data(), str.size())
+          ^ 0xffffffff;
+    }
+
+    return FAT32_SYM(crc32)(str.data(), str.size());
+}
+
+/**
+ * \brief Initialize a guid from a string.
+ *
+ * \note This accepts the same strings as \ref guid_init_from_string: the string
+ * ends at its first NUL, characters other than hex digits are skipped, and
+ * exactly 32 hex digits are required.
+ *
+ * \param id                The guid to initialize.
+ * \param str               The input string from which this guid is
+ *                          initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_STRING_BAD if this string is not a guid.
+ */
+constexpr int guid_init_from_string(guid& id, std::string_view str) noexcept
+{
+    std::array<std::uint8_t, 32> nibbles{};
+    std::size_t index = 0;
+
+    /* collect the hex digits of the sequence. */
+    for (char ch : str)
+    {
+        if ('\0' == ch)
+        {
+            break;
+        }
+
+        int value = detail::hex_value(ch);
+        if (value < 0)
+        {
+            continue;
+        }
+
+        if (index >= 32)
+        {
+            return FAT32_ERROR_GUID_STRING_BAD;
+        }
+
+        nibbles[index++] = static_cast<std::uint8_t>(value);
+    }
+
+    /* the index must be exactly 32. */
+    if (32 != index)
+    {
+        return FAT32_ERROR_GUID_STRING_BAD;
+    }
+
+    /* convert the digits. */
+    auto convert = [&](std::size_t offset, std::size_t count) {
+        std::uint32_t value = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            value = (value << 4) | nibbles[offset + i];
+        }
+        return value;
+    };
+
+    id.data1 = convert(0, 8);
+    id.data2 = static_cast<std::uint16_t>(convert(8, 4));
+    id.data3 = static_cast<std::uint16_t>(convert(12, 4));
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        id.data4[i] = static_cast<std::uint8_t>(convert(16 + i * 2, 2));
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Parse a guid string, failing compilation if it is invalid.
+ *
+ * \param str               The guid string.
+ *
+ * \returns the parsed guid.
+ */
+consteval guid make_guid(std::string_view str)
+{
+    guid id{};
+
+    if (STATUS_SUCCESS != guid_init_from_string(id, str))
+    {
+        throw std::invalid_argument("invalid guid string");
+    }
+
+    return id;
+}
+
+namespace literals {
+
+/**
+ * \brief A guid literal, such as "C12A7328-F81F-11D2-BA4B-00A0C93EC93B"_guid.
+ *
+ * \note An invalid guid string fails compilation.
+ */
+consteval guid operator""_guid(const char* str, std::size_t size)
+{
+    return make_guid(std::string_view(str, size));
+}
+
+/**
+ * \brief A CRC-32 literal, such as "123456789"_crc32.
+ */
+consteval std::uint32_t operator""_crc32(const char* str, std::size_t size)
+{
+    return crc32(std::string_view(str, size));
+}
+
+} /* namespace literals */
+
+} /* namespace fat32 */
+
+/**
+ * \brief Compare two guids for equality, as \ref guid_equal.
+ *
+ * \note This is declared alongside the C guid type, so that argument-dependent
+ * lookup finds it.
+ */
+constexpr bool operator==(
+    const FAT32_SYM(guid)& lhs, const FAT32_SYM(guid)& rhs) noexcept
+{
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        if (lhs.data4[i] != rhs.data4[i])
+        {
+            return false;
+        }
+    }
+
+    return
+        lhs.data1 == rhs.data1 && lhs.data2 == rhs.data2
+     && lhs.data3 == rhs.data3;
+}
+
+/**
+ * \brief Order two guids, as \ref guid_compare.
+ */
+constexpr std::strong_ordering operator<=>(
+    const FAT32_SYM(guid)& lhs, const FAT32_SYM(guid)& rhs) noexcept
+{
+    if (auto order = lhs.data1 <=> rhs.data1; order != 0)
+    {
+        return order;
+    }
+
+    if (auto order = lhs.data2 <=> rhs.data2; order != 0)
+    {
+        return order;
+    }
+
+    if (auto order = lhs.data3 <=> rhs.data3; order != 0)
+    {
+        return order;
+    }
+
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        if (auto order = lhs.data4[i] <=> rhs.data4[i]; order != 0)
+        {
+            return order;
+        }
+    }
+
+    return std::strong_ordering::equal;
+}
+
+/**
+ * \brief Hash guids with \ref guid_hash in unordered containers.
+ */
+template <>
+struct std::hash<FAT32_SYM(guid)>
+{
+    std::size_t operator()(const FAT32_SYM(guid)& id) const noexcept
+    {
+        return static_cast<std::size_t>(FAT32_SYM(guid_hash)(&id));
+    }
+};
@@ -26,6 +26,18 @@ extern "C" {
 
 #define FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_SIZE                      16
 #define FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE                              512
+#define FAT32_GPT_PROTECTIVE_MBR_UNIQUE_DISK_SIGNATURE_OFFSET              440
+#define FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET                   446
+#define FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET                          510
+#define FAT32_GPT_HEADER_SIGNATURE                                  "EFI PART"
+#define FAT32_GPT_HEADER_SIGNATURE_SIZE                                      8
+#define FAT32_GPT_HEADER_SIZE                                               92
+#define FAT32_GPT_HEADER_REVISION                                   0x00010000
+#define FAT32_GPT_HEADER_CRC32_OFFSET                                       16
+#define FAT32_GPT_HEADER_PARTITION_ENTRY_COUNT                             128
+#define FAT32_GPT_HEADER_PARTITION_ENTRY_SIZE                              128
+#define FAT32_GPT_PROBE_MINIMUM_SIZE                                      1024
+#define FAT32_GPT_SCAN_MAX_ENTRY_ARRAY_SIZE                  (1024UL * 1024UL)
 
 /**
  * \brief A partition record in the protective MBR.
@@ -60,6 +72,21 @@ struct FAT32_SYM(gpt_protective_mbr)
     uint16_t signature;
 };
 
+/**
+ * \brief A read-only view of a protective MBR in its on-disk form.
+ *
+ * \note A view reads each field straight from the caller's sector buffer, so
+ * the buffer must outlive the view. Use \ref gpt_protective_mbr_view_init to
+ * validate a sector before reading it through a view.
+ */
+typedef struct FAT32_SYM(gpt_protective_mbr_view)
+FAT32_SYM(gpt_protective_mbr_view);
+
+struct FAT32_SYM(gpt_protective_mbr_view)
+{
+    const uint8_t* sector;
+};
+
 /**
  * \brief The GPT Header.
  *
@@ -102,6 +129,93 @@ struct FAT32_SYM(gpt_partition_entry)
     uint16_t partition_name[36];
 };
 
+/**
+ * \brief Well-known GPT partition types.
+ *
+ * \note Each type corresponds to a partition type guid in the registry. The
+ * unused type is the all-zero guid of an empty partition entry, and any guid
+ * that isn't in the registry is unknown.
+ */
+enum FAT32_SYM(gpt_partition_type)
+{
+    FAT32_GPT_PARTITION_TYPE_UNKNOWN =                                      0,
+    FAT32_GPT_PARTITION_TYPE_UNUSED =                                       1,
+    FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM =                                   2,
+    FAT32_GPT_PARTITION_TYPE_LEGACY_MBR =                                   3,
+    FAT32_GPT_PARTITION_TYPE_BIOS_BOOT =                                    4,
+    FAT32_GPT_PARTITION_TYPE_MICROSOFT_RESERVED =                           5,
+    FAT32_GPT_PARTITION_TYPE_MICROSOFT_BASIC_DATA =                         6,
+    FAT32_GPT_PARTITION_TYPE_MICROSOFT_LDM_METADATA =                       7,
+    FAT32_GPT_PARTITION_TYPE_MICROSOFT_LDM_DATA =                           8,
+    FAT32_GPT_PARTITION_TYPE_WINDOWS_RECOVERY =                             9,
+    FAT32_GPT_PARTITION_TYPE_LINUX_FILESYSTEM =                            10,
+    FAT32_GPT_PARTITION_TYPE_LINUX_SWAP =                                  11,
+    FAT32_GPT_PARTITION_TYPE_LINUX_LVM =                                   12,
+    FAT32_GPT_PARTITION_TYPE_LINUX_RAID =                                  13,
+    FAT32_GPT_PARTITION_TYPE_LINUX_HOME =                                  14,
+    FAT32_GPT_PARTITION_TYPE_LINUX_SRV =                                   15,
+    FAT32_GPT_PARTITION_TYPE_LINUX_VAR =                                   16,
+    FAT32_GPT_PARTITION_TYPE_LINUX_ROOT_X86_64 =                           17,
+    FAT32_GPT_PARTITION_TYPE_LINUX_ROOT_ARM64 =                            18,
+    FAT32_GPT_PARTITION_TYPE_LINUX_USR_X86_64 =                            19,
+    FAT32_GPT_PARTITION_TYPE_LINUX_USR_ARM64 =                             20,
+    FAT32_GPT_PARTITION_TYPE_LINUX_XBOOTLDR =                              21,
+    FAT32_GPT_PARTITION_TYPE_APPLE_HFS_PLUS =                              22,
+    FAT32_GPT_PARTITION_TYPE_APPLE_APFS =                                  23,
+    FAT32_GPT_PARTITION_TYPE_FREEBSD_UFS =                                 24,
+    FAT32_GPT_PARTITION_TYPE_CHROMEOS_KERNEL =                             25,
+    FAT32_GPT_PARTITION_TYPE_CHROMEOS_ROOTFS =                             26,
+    FAT32_GPT_PARTITION_TYPE_COUNT =                                       27,
+};
+
+typedef enum FAT32_SYM(gpt_partition_type) FAT32_SYM(gpt_partition_type);
+
+/**
+ * \brief The classification of the first two sectors of an image.
+ *
+ * \note Each class passes every check of the classes before it. A probe only
+ * looks at signatures, so FAT32_GPT_PROBE_GPT means that a full read is worth
+ * trying, and not that the GPT is valid.
+ */
+enum FAT32_SYM(gpt_probe_result)
+{
+    /* the image is too small to probe. */
+    FAT32_GPT_PROBE_BAD_SIZE =                                              0,
+    /* LBA 0 doesn't have the 0xAA55 MBR signature. */
+    FAT32_GPT_PROBE_NO_MBR =                                                1,
+    /* LBA 0 is an MBR, but not a protective MBR. */
+    FAT32_GPT_PROBE_LEGACY_MBR =                                            2,
+    /* LBA 0 is a protective MBR, but LBA 1 isn't a GPT header. */
+    FAT32_GPT_PROBE_NO_HEADER =                                             3,
+    /* LBA 0 is a protective MBR and LBA 1 has the GPT header signature. */
+    FAT32_GPT_PROBE_GPT =                                                   4,
+};
+
+typedef enum FAT32_SYM(gpt_probe_result) FAT32_SYM(gpt_probe_result);
+
+/**
+ * \brief The classification and partition summary of a scanned image.
+ */
+typedef struct FAT32_SYM(gpt_scan_result) FAT32_SYM(gpt_scan_result);
+
+struct FAT32_SYM(gpt_scan_result)
+{
+    /* STATUS_SUCCESS, or the error that stopped the scan of this image. */
+    int status;
+    FAT32_SYM(gpt_probe_result) probe;
+    /* the view status of LBA 0, or FAT32_ERROR_GPT_BAD_RECORD if the probe
+     * found no protective MBR. */
+    int mbr_status;
+    /* the size in LBA of the protective span record. */
+    uint32_t protective_size_in_lba;
+    /* the number of entries in the primary partition entry array. */
+    uint32_t partition_entry_count;
+    /* the number of entries that are in use. */
+    uint32_t partition_count;
+    /* bit i is set if an entry in use has gpt_partition_type i. */
+    uint32_t partition_type_mask;
+};
+
 /******************************************************************************/
 /* Start of properties.                                                       */
 /******************************************************************************/
@@ -280,6 +394,12 @@ MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_init_span))
  * \brief Initialize a GPT header with the given disk GUID, first usable lba,
  * last usable lba, and alternative lba.
  *
+ * \note This describes a primary header at lba 1, followed by an empty array of
+ * 128 partition entries of 128 bytes each. The array must end before the first
+ * usable lba, and the backup array must fit between the last usable lba and the
+ * alternative lba. Both CRCs are computed here, so the header can be written
+ * as is.
+ *
  * \param header            The record to initialize.
  * \param disk_guid         The disk GUID.
  * \param first_lba         The first usable lba.
@@ -306,10 +426,8 @@ MODEL_CONTRACT_PRECONDITIONS_BEGIN(
         MODEL_ASSERT(FAT32_SYM(property_guid_valid)(disk_guid));
         /* last_lba must be greater than first_lba. */
         MODEL_ASSERT(last_lba > first_lba);
-        /* alt_lba must be less than or equal to last lba. */
-        MODEL_ASSERT(alt_lba <= last_lba);
-        /* alt_lba must be greater than first lba. */
-        MODEL_ASSERT(alt_lba > first_lba);
+        /* the backup header follows the last usable lba. */
+        MODEL_ASSERT(alt_lba > last_lba);
 MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_header_init))
 
 /* postconditions. */
@@ -334,7 +452,8 @@ MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_header_init))
  * disk GUID, start lba (after protective MBR), and end lba.
  *
  * \note This method will compute the first, last, and alt lbas based on the
- * provided parameters, assuming that lba size = 512.
+ * provided parameters, assuming that lba size = 512. The alt lba is the end
+ * lba, and each end leaves 33 lbas for a header and its partition entry array.
  *
  * \param header            The record to initialize.
  * \param disk_guid         The disk GUID.
@@ -516,6 +635,405 @@ MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
         }
 MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_read))
 
+/**
+ * \brief Write a protective mbr spanning the entire disk to a given location in
+ * RAM.
+ *
+ * \note This writes the same bytes as \ref gpt_protective_mbr_init_span
+ * followed by \ref gpt_protective_mbr_write, by copying a serialized template
+ * and patching the size in LBA of the span record.
+ *
+ * \param ptr               The pointer to which this record is written.
+ * \param size              The size of this memory region.
+ * \param disk_size         Size of the entire disk in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_protective_mbr_write_span)(
+    void* ptr, size_t size, size_t disk_size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_protective_mbr_write_span), void* ptr, size_t size,
+    size_t disk_size)
+        /* ptr must be accessible. */
+        MODEL_CHECK_OBJECT_WRITE(ptr, size);
+        (void)disk_size;
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_protective_mbr_write_span))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_protective_mbr_write_span), int retval, void* ptr,
+    size_t size, size_t disk_size)
+        /* this method either succeeds or fails with the following failure
+         * codes. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GPT_BAD_SIZE == retval));
+        /* on success, the sector has the MBR signature. */
+        if (STATUS_SUCCESS == retval)
+        {
+            MODEL_ASSERT(size >= FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE);
+            MODEL_ASSERT(disk_size >= 512UL * 34UL);
+            MODEL_ASSERT(
+                0xAA == ((const uint8_t*)ptr)[
+                    FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET + 1]);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_write_span))
+
+/**
+ * \brief Compute the CRC of a GPT header and store it in its header_crc32.
+ *
+ * \note \ref gpt_header_write writes the stored CRC as is, so call this after
+ * changing any field of an initialized header.
+ *
+ * \param header            The header to update.
+ */
+void FAT32_SYM(gpt_header_update_crc32)(FAT32_SYM(gpt_header)* header);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_header_update_crc32), FAT32_SYM(gpt_header)* header)
+        /* header must be valid. */
+        MODEL_ASSERT(FAT32_SYM(property_gpt_header_valid)(header));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_header_update_crc32))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_header_update_crc32), FAT32_SYM(gpt_header)* header)
+        /* the header is still valid. */
+        MODEL_ASSERT(FAT32_SYM(property_gpt_header_valid)(header));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_header_update_crc32))
+
+/**
+ * \brief Read a GPT header from a given location in RAM.
+ *
+ * \note The signature and the header CRC are checked against the raw bytes
+ * before any field is decoded, so a sector that isn't a GPT header is rejected
+ * without decoding it.
+ *
+ * \param header            The header to populate with RAM data.
+ * \param ptr               The pointer from which this data is read.
+ * \param size              The size of this data, which is the lba size when
+ *                          reading a whole sector.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GPT_BAD_SIZE if size is too small for a header.
+ *      - FAT32_ERROR_GPT_HEADER_BAD_SIGNATURE if the signature doesn't match.
+ *      - FAT32_ERROR_GPT_BAD_RECORD if the header size is out of range, or if
+ *        the decoded header isn't valid.
+ *      - FAT32_ERROR_GPT_HEADER_BAD_CRC if the header CRC doesn't match.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_header_read)(
+    FAT32_SYM(gpt_header)* header, const void* ptr, size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_header_read),
+    FAT32_SYM(gpt_header)* header, const void* ptr, size_t size)
+        /* header must be accessible. */
+        MODEL_CHECK_OBJECT_RW(header, sizeof(*header));
+        /* ptr must be accessible. */
+        MODEL_CHECK_OBJECT_READ(ptr, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_header_read))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_header_read),
+    int retval, FAT32_SYM(gpt_header)* header, const void* ptr, size_t size)
+        /* this method either succeeds or fails with one of the following
+         * failure codes. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GPT_BAD_SIZE == retval)
+         || (FAT32_ERROR_GPT_HEADER_BAD_SIGNATURE == retval)
+         || (FAT32_ERROR_GPT_BAD_RECORD == retval)
+         || (FAT32_ERROR_GPT_HEADER_BAD_CRC == retval));
+        /* if this method succeeds, then the header is valid. */
+        if (STATUS_SUCCESS == retval)
+        {
+            MODEL_ASSERT(FAT32_SYM(property_gpt_header_valid)(header));
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_header_read))
+
+/**
+ * \brief Write a GPT header to a given location in RAM.
+ *
+ * \note The fields are serialized straight into this region, with the stored
+ * header CRC, and the rest of the region is cleared.
+ *
+ * \param ptr               The pointer to which this header is written.
+ * \param size              The size of this memory region.
+ * \param header            The header to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_header_write)(
+    void* ptr, size_t size, const FAT32_SYM(gpt_header)* header);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_header_write),
+    void* ptr, size_t size, const FAT32_SYM(gpt_header)* header)
+        /* header must be valid. */
+        MODEL_ASSERT(FAT32_SYM(property_gpt_header_valid)(header));
+        /* ptr must be accessible. */
+        MODEL_CHECK_OBJECT_WRITE(ptr, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_header_write))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_header_write),
+    int retval, void* ptr, size_t size, const FAT32_SYM(gpt_header)* header)
+        /* this method either succeeds or fails with the following failure
+         * codes. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GPT_BAD_SIZE == retval));
+        /* on success, the region holds at least a whole header. */
+        if (STATUS_SUCCESS == retval)
+        {
+            MODEL_ASSERT(size >= FAT32_GPT_HEADER_SIZE);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_header_write))
+
+/**
+ * \brief Validate a protective mbr in place and view it.
+ *
+ * \note This applies the same checks as \ref gpt_protective_mbr_read, in the
+ * same order and with the same error codes, but reads the sector where it is
+ * instead of copying it into a \ref gpt_protective_mbr.
+ *
+ * \param view              The view to initialize.
+ * \param ptr               The sector to view, which must outlive the view.
+ * \param size              The size of this sector.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_protective_mbr_view_init)(
+    FAT32_SYM(gpt_protective_mbr_view)* view, const void* ptr, size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_protective_mbr_view_init),
+    FAT32_SYM(gpt_protective_mbr_view)* view, const void* ptr, size_t size)
+        /* view must be accessible. */
+        MODEL_CHECK_OBJECT_RW(view, sizeof(*view));
+        /* ptr must be accessible. */
+        MODEL_CHECK_OBJECT_READ(ptr, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_protective_mbr_view_init))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_protective_mbr_view_init),
+    int retval, FAT32_SYM(gpt_protective_mbr_view)* view, const void* ptr,
+    size_t size)
+        /* this method either succeeds or fails with one of the following
+         * failure codes. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GPT_BAD_SIZE == retval)
+         || (FAT32_ERROR_GPT_BAD_RECORD == retval)
+         || (FAT32_ERROR_GPT_MBR_BAD_SIGNATURE == retval));
+        /* if this method succeeds, then the view is over the sector. */
+        if (STATUS_SUCCESS == retval)
+        {
+            MODEL_ASSERT(view->sector == (const uint8_t*)ptr);
+            MODEL_ASSERT(size >= FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_view_init))
+
+/******************************************************************************/
+/* Start of protective MBR view accessors.                                    */
+/******************************************************************************/
+
+/**
+ * \brief Get the boot code of a protective mbr view.
+ *
+ * \param view              The view.
+ *
+ * \returns the 440 bytes of boot code in the sector.
+ */
+static inline const uint8_t*
+FAT32_SYM(gpt_protective_mbr_view_boot_code)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view)
+{
+    return view->sector;
+}
+
+/**
+ * \brief Get the unique disk signature of a protective mbr view.
+ *
+ * \param view              The view.
+ *
+ * \returns the 4 bytes of the unique disk signature in the sector.
+ */
+static inline const uint8_t*
+FAT32_SYM(gpt_protective_mbr_view_unique_disk_signature)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view)
+{
+    return view->sector + FAT32_GPT_PROTECTIVE_MBR_UNIQUE_DISK_SIGNATURE_OFFSET;
+}
+
+/**
+ * \brief Get the signature of a protective mbr view.
+ *
+ * \param view              The view.
+ *
+ * \returns the signature.
+ */
+static inline uint16_t
+FAT32_SYM(gpt_protective_mbr_view_signature)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view)
+{
+    const uint8_t* bptr =
+        view->sector + FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET;
+
+    return (uint16_t)(((uint16_t)bptr[0]) | (((uint16_t)bptr[1]) << 8));
+}
+
+/**
+ * \brief Get a partition record of a protective mbr view in on-disk form.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the 16 bytes of this partition record in the sector.
+ */
+static inline const uint8_t*
+FAT32_SYM(gpt_protective_mbr_view_record)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    return
+        view->sector + FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET
+      + index * FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_SIZE;
+}
+
+/**
+ * \brief Get the boot indicator of a partition record in a view.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the boot indicator.
+ */
+static inline uint8_t
+FAT32_SYM(gpt_protective_mbr_view_record_boot_indicator)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    return FAT32_SYM(gpt_protective_mbr_view_record)(view, index)[0];
+}
+
+/**
+ * \brief Get the starting CHS of a partition record in a view.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the 24-bit starting CHS.
+ */
+static inline uint32_t
+FAT32_SYM(gpt_protective_mbr_view_record_starting_chs)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    const uint8_t* bptr =
+        FAT32_SYM(gpt_protective_mbr_view_record)(view, index);
+
+    return
+        ((uint32_t)bptr[1]) | (((uint32_t)bptr[2]) << 8)
+      | (((uint32_t)bptr[3]) << 16);
+}
+
+/**
+ * \brief Get the OS type of a partition record in a view.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the OS type.
+ */
+static inline uint8_t
+FAT32_SYM(gpt_protective_mbr_view_record_os_type)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    return FAT32_SYM(gpt_protective_mbr_view_record)(view, index)[4];
+}
+
+/**
+ * \brief Get the ending CHS of a partition record in a view.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the 24-bit ending CHS.
+ */
+static inline uint32_t
+FAT32_SYM(gpt_protective_mbr_view_record_ending_chs)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    const uint8_t* bptr =
+        FAT32_SYM(gpt_protective_mbr_view_record)(view, index);
+
+    return
+        ((uint32_t)bptr[5]) | (((uint32_t)bptr[6]) << 8)
+      | (((uint32_t)bptr[7]) << 16);
+}
+
+/**
+ * \brief Get the starting LBA of a partition record in a view.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the starting LBA.
+ */
+static inline uint32_t
+FAT32_SYM(gpt_protective_mbr_view_record_starting_lba)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    const uint8_t* bptr =
+        FAT32_SYM(gpt_protective_mbr_view_record)(view, index);
+
+    return
+        ((uint32_t)bptr[8]) | (((uint32_t)bptr[9]) << 8)
+      | (((uint32_t)bptr[10]) << 16) | (((uint32_t)bptr[11]) << 24);
+}
+
+/**
+ * \brief Get the size in LBA of a partition record in a view.
+ *
+ * \param view              The view.
+ * \param index             The index of the record, from 0 to 3.
+ *
+ * \returns the size in LBA.
+ */
+static inline uint32_t
+FAT32_SYM(gpt_protective_mbr_view_record_size_in_lba)(
+    const FAT32_SYM(gpt_protective_mbr_view)* view, size_t index)
+{
+    const uint8_t* bptr =
+        FAT32_SYM(gpt_protective_mbr_view_record)(view, index);
+
+    return
+        ((uint32_t)bptr[12]) | (((uint32_t)bptr[13]) << 8)
+      | (((uint32_t)bptr[14]) << 16) | (((uint32_t)bptr[15]) << 24);
+}
+
+/******************************************************************************/
+/* End of protective MBR view accessors.                                      */
+/******************************************************************************/
+
 /**
  * \brief Write a protective mbr to a given location in RAM.
  *
@@ -551,6 +1069,167 @@ MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
          || (FAT32_ERROR_GPT_BAD_SIZE));
 MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_write))
 
+/**
+ * \brief Quickly classify the first two sectors of an image.
+ *
+ * \note This checks the MBR signature, the 0xEE type of the first partition
+ * record, the zero unique disk signature, and the GPT header signature, and
+ * nothing else. It never rejects a sector that \ref gpt_protective_mbr_read
+ * accepts, so it can screen images before a full read.
+ *
+ * \param ptr               LBA 0 and LBA 1 of the image, with 512-byte LBAs.
+ * \param size              The size of this data.
+ *
+ * \returns the classification of these sectors.
+ */
+FAT32_SYM(gpt_probe_result)
+FAT32_SYM(gpt_probe)(const void* ptr, size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_probe), const void* ptr, size_t size)
+        /* ptr must be accessible. */
+        MODEL_CHECK_OBJECT_READ(ptr, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_probe))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_probe), FAT32_SYM(gpt_probe_result) retval,
+    const void* ptr, size_t size)
+        /* the classification is in range. */
+        MODEL_ASSERT(
+            retval >= FAT32_GPT_PROBE_BAD_SIZE
+         && retval <= FAT32_GPT_PROBE_GPT);
+        /* only a large enough image is probed. */
+        MODEL_ASSERT(
+            (FAT32_GPT_PROBE_BAD_SIZE == retval)
+                == (size < FAT32_GPT_PROBE_MINIMUM_SIZE));
+        /* anything past the MBR class has the MBR signature. */
+        if (retval >= FAT32_GPT_PROBE_LEGACY_MBR)
+        {
+            MODEL_ASSERT(
+                0x55 == ((const uint8_t*)ptr)[
+                    FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET]);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_probe))
+
+/**
+ * \brief Classify a list of raw images and summarize their partitions.
+ *
+ * \note Each image is opened and its first 34 LBAs are read with a single
+ * pread, which covers the protective MBR, the GPT header, and the usual
+ * location of the primary partition entry array. Images are handed out to a
+ * pool of workers in batches, and the calling thread is one of the workers.
+ * Only signatures, the protective MBR, and the partition types are checked;
+ * the header and entry array CRCs are not.
+ *
+ * \param results           The array of results, one per path.
+ * \param paths             The array of image paths.
+ * \param count             The number of images.
+ * \param threads           The number of workers, or 0 for one per CPU.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, in which case each result holds the status
+ *        of its image.
+ *      - FAT32_ERROR_GPT_SCAN_OUT_OF_MEMORY if the calling thread can't
+ *        allocate its read buffer.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_scan_images)(
+    FAT32_SYM(gpt_scan_result)* results, const char* const* paths,
+    size_t count, size_t threads);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_scan_images), FAT32_SYM(gpt_scan_result)* results,
+    const char* const* paths, size_t count, size_t threads)
+        /* results must be accessible. */
+        MODEL_CHECK_OBJECT_RW(results, count * sizeof(*results));
+        /* paths must be accessible. */
+        MODEL_CHECK_OBJECT_READ(paths, count * sizeof(*paths));
+        (void)threads;
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_scan_images))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_scan_images), int retval)
+        /* this method either succeeds or runs out of memory. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GPT_SCAN_OUT_OF_MEMORY == retval));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_scan_images))
+
+/**
+ * \brief Classify a partition type guid in its on-disk form.
+ *
+ * \note This looks the 16 raw bytes of a partition entry's type guid up in the
+ * registry with a perfect hash and a single compare, so no guid conversion or
+ * string work is needed.
+ *
+ * \param data              The 16-byte on-disk partition type guid.
+ *
+ * \returns the partition type, or FAT32_GPT_PARTITION_TYPE_UNKNOWN if this guid
+ * isn't in the registry.
+ */
+FAT32_SYM(gpt_partition_type)
+FAT32_SYM(gpt_partition_type_from_raw)(const void* data);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_partition_type_from_raw), const void* data)
+        /* data must be accessible. */
+        MODEL_CHECK_OBJECT_READ(data, FAT32_GUID_BINARY_SIZE);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_partition_type_from_raw))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_partition_type_from_raw),
+    FAT32_SYM(gpt_partition_type) retval)
+        /* the type is in range. */
+        MODEL_ASSERT(
+            retval >= FAT32_GPT_PARTITION_TYPE_UNKNOWN
+         && retval < FAT32_GPT_PARTITION_TYPE_COUNT);
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_partition_type_from_raw))
+
+/**
+ * \brief Get the partition type guid of a well-known partition type.
+ *
+ * \param id                The guid to initialize.
+ * \param type              The partition type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GPT_BAD_PARTITION_TYPE if the type is unknown or out of
+ *        range.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_partition_type_guid)(
+    FAT32_SYM(guid)* id, FAT32_SYM(gpt_partition_type) type);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(gpt_partition_type_guid), FAT32_SYM(guid)* id,
+    FAT32_SYM(gpt_partition_type) type)
+        /* id must be accessible. */
+        MODEL_CHECK_OBJECT_RW(id, sizeof(*id));
+        (void)type;
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(gpt_partition_type_guid))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(gpt_partition_type_guid), int retval,
+    FAT32_SYM(gpt_partition_type) type)
+        /* this call succeeds exactly for the registered types. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+                == (type > FAT32_GPT_PARTITION_TYPE_UNKNOWN
+                 && type < FAT32_GPT_PARTITION_TYPE_COUNT));
+        /* otherwise, it fails with a FAT32_ERROR_GPT_BAD_PARTITION_TYPE. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GPT_BAD_PARTITION_TYPE == retval));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_partition_type_guid))
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -560,8 +1239,13 @@ MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_write))
     typedef FAT32_SYM(gpt_protective_mbr_partition_record) \
     sym ## gpt_protective_mbr_partition_record; \
     typedef FAT32_SYM(gpt_protective_mbr) sym ## gpt_protective_mbr; \
+    typedef FAT32_SYM(gpt_protective_mbr_view) \
+    sym ## gpt_protective_mbr_view; \
     typedef FAT32_SYM(gpt_header) sym ## gpt_header; \
     typedef FAT32_SYM(gpt_partition_entry) sym ## gpt_partition_entry; \
+    typedef FAT32_SYM(gpt_partition_type) sym ## gpt_partition_type; \
+    typedef FAT32_SYM(gpt_probe_result) sym ## gpt_probe_result; \
+    typedef FAT32_SYM(gpt_scan_result) sym ## gpt_scan_result; \
     static inline bool \
     sym ## property_gpt_protective_mbr_partition_record_valid( \
         const FAT32_SYM(gpt_protective_mbr_partition_record)* x) { \
@@ -631,6 +1315,88 @@ MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(gpt_protective_mbr_write))
     sym ## gpt_protective_mbr_write( \
         void* x, size_t y, const FAT32_SYM(gpt_protective_mbr)* z) { \
             return FAT32_SYM(gpt_protective_mbr_write)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## gpt_protective_mbr_write_span( \
+        void* x, size_t y, size_t z) { \
+            return FAT32_SYM(gpt_protective_mbr_write_span)(x,y,z); } \
+    static inline void \
+    sym ## gpt_header_update_crc32(FAT32_SYM(gpt_header)* x) { \
+            FAT32_SYM(gpt_header_update_crc32)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## gpt_header_read( \
+        FAT32_SYM(gpt_header)* x, const void* y, size_t z) { \
+            return FAT32_SYM(gpt_header_read)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## gpt_header_write( \
+        void* x, size_t y, const FAT32_SYM(gpt_header)* z) { \
+            return FAT32_SYM(gpt_header_write)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## gpt_protective_mbr_view_init( \
+        FAT32_SYM(gpt_protective_mbr_view)* x, const void* y, size_t z) { \
+            return FAT32_SYM(gpt_protective_mbr_view_init)(x,y,z); } \
+    static inline const uint8_t* \
+    sym ## gpt_protective_mbr_view_boot_code( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x) { \
+            return FAT32_SYM(gpt_protective_mbr_view_boot_code)(x); } \
+    static inline const uint8_t* \
+    sym ## gpt_protective_mbr_view_unique_disk_signature( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x) { \
+            return \
+                FAT32_SYM(gpt_protective_mbr_view_unique_disk_signature)(x); } \
+    static inline uint16_t \
+    sym ## gpt_protective_mbr_view_signature( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x) { \
+            return FAT32_SYM(gpt_protective_mbr_view_signature)(x); } \
+    static inline const uint8_t* \
+    sym ## gpt_protective_mbr_view_record( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return FAT32_SYM(gpt_protective_mbr_view_record)(x,y); } \
+    static inline uint8_t \
+    sym ## gpt_protective_mbr_view_record_boot_indicator( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return \
+                FAT32_SYM(gpt_protective_mbr_view_record_boot_indicator)( \
+                    x,y); } \
+    static inline uint32_t \
+    sym ## gpt_protective_mbr_view_record_starting_chs( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return \
+                FAT32_SYM(gpt_protective_mbr_view_record_starting_chs)(x,y); } \
+    static inline uint8_t \
+    sym ## gpt_protective_mbr_view_record_os_type( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return FAT32_SYM(gpt_protective_mbr_view_record_os_type)(x,y); } \
+    static inline uint32_t \
+    sym ## gpt_protective_mbr_view_record_ending_chs( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return \
+                FAT32_SYM(gpt_protective_mbr_view_record_ending_chs)(x,y); } \
+    static inline uint32_t \
+    sym ## gpt_protective_mbr_view_record_starting_lba( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return \
+                FAT32_SYM(gpt_protective_mbr_view_record_starting_lba)(x,y); } \
+    static inline uint32_t \
+    sym ## gpt_protective_mbr_view_record_size_in_lba( \
+        const FAT32_SYM(gpt_protective_mbr_view)* x, size_t y) { \
+            return \
+                FAT32_SYM(gpt_protective_mbr_view_record_size_in_lba)(x,y); } \
+    static inline FAT32_SYM(gpt_probe_result) \
+    sym ## gpt_probe(const void* x, size_t y) { \
+            return FAT32_SYM(gpt_probe)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## gpt_scan_images( \
+        FAT32_SYM(gpt_scan_result)* w, const char* const* x, size_t y, \
+        size_t z) { \
+            return FAT32_SYM(gpt_scan_images)(w,x,y,z); } \
+    static inline FAT32_SYM(gpt_partition_type) \
+    sym ## gpt_partition_type_from_raw( \
+        const void* x) { \
+            return FAT32_SYM(gpt_partition_type_from_raw)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## gpt_partition_type_guid( \
+        FAT32_SYM(guid)* x, FAT32_SYM(gpt_partition_type) y) { \
+            return FAT32_SYM(gpt_partition_type_guid)(x,y); } \
     FAT32_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define FAT32_IMPORT_gpt_as(sym) \
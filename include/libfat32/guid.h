@@ -40,6 +40,36 @@ struct FAT32_SYM(guid)
     uint8_t data4[8];
 };
 
+/**
+ * \brief A slot in a \ref guid_map.
+ *
+ * \note A slot with a zero hash is empty. The caller owns the slot array, and
+ * should treat the slots as opaque once the map is initialized.
+ */
+typedef struct FAT32_SYM(guid_map_entry) FAT32_SYM(guid_map_entry);
+
+struct FAT32_SYM(guid_map_entry)
+{
+    uint64_t hash;
+    FAT32_SYM(guid) key;
+    void* value;
+};
+
+/**
+ * \brief An open-addressing hash map from guids to values.
+ *
+ * \note The map uses linear probing over a caller-provided array of slots,
+ * whose size is a power of two. It never allocates memory.
+ */
+typedef struct FAT32_SYM(guid_map) FAT32_SYM(guid_map);
+
+struct FAT32_SYM(guid_map)
+{
+    FAT32_SYM(guid_map_entry)* entries;
+    size_t capacity;
+    size_t count;
+};
+
 /******************************************************************************/
 /* Start of properties.                                                       */
 /******************************************************************************/
@@ -54,6 +84,19 @@ struct FAT32_SYM(guid)
 bool FAT32_SYM(property_guid_valid)(
     const FAT32_SYM(guid)* id);
 
+/**
+ * \brief Returns true if the given guid map is valid.
+ *
+ * \note A valid map has an accessible slot array whose size is a power of two,
+ * and no more entries than it can hold.
+ *
+ * \param map           The map to check.
+ *
+ * \returns true if this map is valid and false otherwise.
+ */
+bool FAT32_SYM(property_guid_map_valid)(
+    const FAT32_SYM(guid_map)* map);
+
 /******************************************************************************/
 /* Start of constructors.                                                     */
 /******************************************************************************/
@@ -130,6 +173,263 @@ MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
          || (FAT32_ERROR_GUID_DATA_INVALID_SIZE == retval));
 MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_init_from_data))
 
+/**
+ * \brief Initialize an array of guids from an array of strings.
+ *
+ * \note The strings are laid out contiguously, FAT32_GUID_STRING_SIZE bytes
+ * apart, as written by \ref guid_write_to_string_n. Each must be zero
+ * terminated within its slot, and is parsed as by \ref guid_init_from_string.
+ *
+ * \param ids               The guids to initialize.
+ * \param count             The number of guids.
+ * \param str               The input strings.
+ * \param size              The size of the input strings in bytes.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          initialized, or to count on success. The guids
+ *                          before this index are initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_init_from_string_n)(
+    FAT32_SYM(guid)* ids, size_t count, const char* str, size_t size,
+    size_t* failed_index);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_init_from_string_n),
+    FAT32_SYM(guid)* ids, size_t count, const char* str, size_t size,
+    size_t* failed_index)
+        /* ids must be accessible. */
+        MODEL_CHECK_OBJECT_RW(ids, count * sizeof(*ids));
+        /* str must be readable. */
+        MODEL_CHECK_OBJECT_READ(str, size);
+        /* failed_index must be accessible. */
+        MODEL_CHECK_OBJECT_RW(failed_index, sizeof(*failed_index));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_init_from_string_n))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_init_from_string_n),
+    int retval, FAT32_SYM(guid)* ids, size_t count, const char* str,
+    size_t size, size_t* failed_index)
+        /* this call either succeeds for every guid or fails with a
+         * FAT32_ERROR_GUID_STRING_BAD at an index in the array. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval && count == *failed_index)
+         || (FAT32_ERROR_GUID_STRING_BAD == retval && *failed_index < count));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_init_from_string_n))
+
+/**
+ * \brief Initialize an array of guids from an array of binary data.
+ *
+ * \param ids               The guids to initialize.
+ * \param count             The number of guids.
+ * \param ptr               Pointer to the binary data from which these guids
+ *                          are initialized, FAT32_GUID_BINARY_SIZE bytes each.
+ * \param size              The size of this data, which must be exactly count
+ *                          guids.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          initialized, or to count on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_init_from_data_n)(
+    FAT32_SYM(guid)* ids, size_t count, const void* ptr, size_t size,
+    size_t* failed_index);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_init_from_data_n),
+    FAT32_SYM(guid)* ids, size_t count, const void* ptr, size_t size,
+    size_t* failed_index)
+        /* ids must be accessible. */
+        MODEL_CHECK_OBJECT_RW(ids, count * sizeof(*ids));
+        /* data must be readable. */
+        MODEL_CHECK_OBJECT_READ(ptr, size);
+        /* failed_index must be accessible. */
+        MODEL_CHECK_OBJECT_RW(failed_index, sizeof(*failed_index));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_init_from_data_n))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_init_from_data_n),
+    int retval, FAT32_SYM(guid)* ids, size_t count, const void* ptr,
+    size_t size, size_t* failed_index)
+        /* this call either succeeds for every guid or fails with a
+         * FAT32_ERROR_GUID_DATA_INVALID_SIZE before converting any. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval && count == *failed_index)
+         || (FAT32_ERROR_GUID_DATA_INVALID_SIZE == retval
+                && 0 == *failed_index));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_init_from_data_n))
+
+/**
+ * \brief Initialize a guid with a new random (version 4) value.
+ *
+ * \note The value comes from a per-thread cryptographically secure generator
+ * that is seeded once from the operating system, so this doesn't take a lock
+ * or wait for entropy after the first call in each thread.
+ *
+ * \param id                The guid to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_generate_v4)(FAT32_SYM(guid)* id);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_generate_v4), FAT32_SYM(guid)* id)
+        /* id must be accessible. */
+        MODEL_CHECK_OBJECT_RW(id, sizeof(*id));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_generate_v4))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_generate_v4), int retval, FAT32_SYM(guid)* id)
+        /* this call either succeeds or fails with a
+         * FAT32_ERROR_GUID_RANDOM_UNAVAILABLE. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GUID_RANDOM_UNAVAILABLE == retval));
+        /* on success, the guid is a version 4, variant 1 guid. */
+        if (STATUS_SUCCESS == retval)
+        {
+            MODEL_ASSERT(0x4000 == (id->data3 & 0xf000));
+            MODEL_ASSERT(0x80 == (id->data4[0] & 0xc0));
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_generate_v4))
+
+/**
+ * \brief Initialize an array of guids with new random (version 4) values.
+ *
+ * \note This draws the random bytes for every guid in one call to the
+ * generator.
+ *
+ * \param ids               The guids to initialize.
+ * \param count             The number of guids.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_generate_v4_n)(FAT32_SYM(guid)* ids, size_t count);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_generate_v4_n), FAT32_SYM(guid)* ids, size_t count)
+        /* ids must be accessible. */
+        MODEL_CHECK_OBJECT_RW(ids, count * sizeof(*ids));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_generate_v4_n))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_generate_v4_n), int retval, FAT32_SYM(guid)* ids,
+    size_t count)
+        /* this call either succeeds or fails with a
+         * FAT32_ERROR_GUID_RANDOM_UNAVAILABLE. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GUID_RANDOM_UNAVAILABLE == retval));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_generate_v4_n))
+
+/**
+ * \brief Initialize a guid with a name-based (version 5) value.
+ *
+ * \note This follows RFC 9562, section 5.5: the guid is derived from the
+ * SHA-1 digest of the namespace guid, in its big-endian binary form, followed
+ * by the name. The same namespace and name always produce the same guid.
+ *
+ * \param id                The guid to initialize.
+ * \param ns                The namespace guid.
+ * \param name              The name bytes.
+ * \param size              The size of the name.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_init_from_name)(
+    FAT32_SYM(guid)* id, const FAT32_SYM(guid)* ns, const void* name,
+    size_t size);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_init_from_name), FAT32_SYM(guid)* id,
+    const FAT32_SYM(guid)* ns, const void* name, size_t size)
+        /* id must be accessible. */
+        MODEL_CHECK_OBJECT_RW(id, sizeof(*id));
+        /* ns must be accessible. */
+        MODEL_CHECK_OBJECT_READ(ns, sizeof(*ns));
+        /* name must be accessible. */
+        MODEL_CHECK_OBJECT_READ(name, size);
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_init_from_name))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_init_from_name), int retval, FAT32_SYM(guid)* id)
+        /* this call always succeeds. */
+        MODEL_ASSERT(STATUS_SUCCESS == retval);
+        /* the guid is a version 5, variant 1 guid. */
+        MODEL_ASSERT(0x5000 == (id->data3 & 0xf000));
+        MODEL_ASSERT(0x80 == (id->data4[0] & 0xc0));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_init_from_name))
+
+/**
+ * \brief Initialize an empty guid map over a caller-provided slot array.
+ *
+ * \note The map holds at most 7/8 of its capacity, so that lookups stay short.
+ * The slot array must outlive the map.
+ *
+ * \param map               The map to initialize.
+ * \param entries           The slot array.
+ * \param capacity          The number of slots, which must be a power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_MAP_BAD_CAPACITY if the capacity isn't a power of
+ *        two.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_init)(
+    FAT32_SYM(guid_map)* map, FAT32_SYM(guid_map_entry)* entries,
+    size_t capacity);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_init), FAT32_SYM(guid_map)* map,
+    FAT32_SYM(guid_map_entry)* entries, size_t capacity)
+        /* map must be accessible. */
+        MODEL_CHECK_OBJECT_RW(map, sizeof(*map));
+        /* entries must be accessible. */
+        MODEL_CHECK_OBJECT_RW(entries, capacity * sizeof(*entries));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_map_init))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_init), int retval, FAT32_SYM(guid_map)* map)
+        /* this call either succeeds or fails with a
+         * FAT32_ERROR_GUID_MAP_BAD_CAPACITY. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GUID_MAP_BAD_CAPACITY == retval));
+        /* on success, the map is valid and empty. */
+        if (STATUS_SUCCESS == retval)
+        {
+            MODEL_ASSERT(FAT32_SYM(property_guid_map_valid)(map));
+            MODEL_ASSERT(0 == map->count);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_map_init))
+
 /******************************************************************************/
 /* Start of public methods.                                                   */
 /******************************************************************************/
@@ -206,6 +506,411 @@ MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
          || (FAT32_ERROR_GUID_DATA_INVALID_SIZE == retval));
 MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_write_to_binary))
 
+/**
+ * \brief Write an array of guids to an array of strings.
+ *
+ * \note Each guid is written as by \ref guid_write_to_string, and the strings
+ * are laid out contiguously, FAT32_GUID_STRING_SIZE bytes apart.
+ *
+ * \param str               The string buffer.
+ * \param size              The size of the string buffer, which must hold at
+ *                          least count strings.
+ * \param ids               The guids to write.
+ * \param count             The number of guids.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          written, or to count on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_write_to_string_n)(
+    char* str, size_t size, const FAT32_SYM(guid)* ids, size_t count,
+    size_t* failed_index);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_write_to_string_n),
+    char* str, size_t size, const FAT32_SYM(guid)* ids, size_t count,
+    size_t* failed_index)
+        /* str must be accessible. */
+        MODEL_CHECK_OBJECT_WRITE(str, size);
+        /* ids must be accessible. */
+        MODEL_CHECK_OBJECT_READ(ids, count * sizeof(*ids));
+        /* failed_index must be accessible. */
+        MODEL_CHECK_OBJECT_RW(failed_index, sizeof(*failed_index));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_write_to_string_n))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_write_to_string_n),
+    int retval, char* str, size_t size, const FAT32_SYM(guid)* ids,
+    size_t count, size_t* failed_index)
+        /* this call either succeeds for every guid or fails with a
+         * FAT32_ERROR_GUID_STRING_BAD before writing any. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval && count == *failed_index)
+         || (FAT32_ERROR_GUID_STRING_BAD == retval && 0 == *failed_index));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_write_to_string_n))
+
+/**
+ * \brief Write an array of guids to a binary buffer.
+ *
+ * \param buffer            The binary buffer.
+ * \param size              The size of the binary buffer, which must be exactly
+ *                          count guids.
+ * \param ids               The guids to write.
+ * \param count             The number of guids.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          written, or to count on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_write_to_binary_n)(
+    void* buffer, size_t size, const FAT32_SYM(guid)* ids, size_t count,
+    size_t* failed_index);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_write_to_binary_n),
+    void* buffer, size_t size, const FAT32_SYM(guid)* ids, size_t count,
+    size_t* failed_index)
+        /* buffer must be accessible. */
+        MODEL_CHECK_OBJECT_WRITE(buffer, size);
+        /* ids must be accessible. */
+        MODEL_CHECK_OBJECT_READ(ids, count * sizeof(*ids));
+        /* failed_index must be accessible. */
+        MODEL_CHECK_OBJECT_RW(failed_index, sizeof(*failed_index));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_write_to_binary_n))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_write_to_binary_n),
+    int retval, void* buffer, size_t size, const FAT32_SYM(guid)* ids,
+    size_t count, size_t* failed_index)
+        /* this call either succeeds for every guid or fails with a
+         * FAT32_ERROR_GUID_DATA_INVALID_SIZE before writing any. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval && count == *failed_index)
+         || (FAT32_ERROR_GUID_DATA_INVALID_SIZE == retval
+                && 0 == *failed_index));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_write_to_binary_n))
+
+/**
+ * \brief Returns true if two guids are equal.
+ *
+ * \param lhs               The left-hand guid.
+ * \param rhs               The right-hand guid.
+ *
+ * \returns true if these guids are equal and false otherwise.
+ */
+bool FAT32_SYM(guid_equal)(
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_equal),
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs)
+        /* lhs must be accessible. */
+        MODEL_CHECK_OBJECT_READ(lhs, sizeof(*lhs));
+        /* rhs must be accessible. */
+        MODEL_CHECK_OBJECT_READ(rhs, sizeof(*rhs));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_equal))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_equal), bool retval,
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs)
+        /* the guids are equal exactly when every field is equal. */
+        MODEL_ASSERT(
+            retval
+                == (lhs->data1 == rhs->data1
+                 && lhs->data2 == rhs->data2
+                 && lhs->data3 == rhs->data3
+                 && lhs->data4[0] == rhs->data4[0]
+                 && lhs->data4[1] == rhs->data4[1]
+                 && lhs->data4[2] == rhs->data4[2]
+                 && lhs->data4[3] == rhs->data4[3]
+                 && lhs->data4[4] == rhs->data4[4]
+                 && lhs->data4[5] == rhs->data4[5]
+                 && lhs->data4[6] == rhs->data4[6]
+                 && lhs->data4[7] == rhs->data4[7]));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_equal))
+
+/**
+ * \brief Compare two guids.
+ *
+ * \note Guids are ordered by data1, data2, data3, and then the bytes of data4,
+ * which is the order of their canonical strings.
+ *
+ * \param lhs               The left-hand guid.
+ * \param rhs               The right-hand guid.
+ *
+ * \returns a negative value if lhs orders before rhs, zero if they are equal,
+ * and a positive value if lhs orders after rhs.
+ */
+int FAT32_SYM(guid_compare)(
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_compare),
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs)
+        /* lhs must be accessible. */
+        MODEL_CHECK_OBJECT_READ(lhs, sizeof(*lhs));
+        /* rhs must be accessible. */
+        MODEL_CHECK_OBJECT_READ(rhs, sizeof(*rhs));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_compare))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_compare), int retval,
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs)
+        /* the guids compare equal exactly when they are equal. */
+        MODEL_ASSERT((0 == retval) == FAT32_SYM(guid_equal)(lhs, rhs));
+        /* the first field decides the order. */
+        if (lhs->data1 != rhs->data1)
+        {
+            MODEL_ASSERT((retval < 0) == (lhs->data1 < rhs->data1));
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_compare))
+
+/**
+ * \brief Hash a guid.
+ *
+ * \note The hash covers the 16-byte binary form of the guid, and is the same
+ * on every host. It is meant for hash tables, not for security.
+ *
+ * \param id                The guid to hash.
+ *
+ * \returns the 64-bit hash of this guid.
+ */
+uint64_t FAT32_SYM(guid_hash)(const FAT32_SYM(guid)* id);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_hash), const FAT32_SYM(guid)* id)
+        /* id must be accessible. */
+        MODEL_CHECK_OBJECT_READ(id, sizeof(*id));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_hash))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_hash), uint64_t retval, const FAT32_SYM(guid)* id)
+        /* the hash is a pure function of the guid. */
+        (void)retval;
+        (void)id;
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_hash))
+
+/**
+ * \brief Returns true if a guid in its on-disk form matches a guid.
+ *
+ * \note The target is encoded once and compared with the 16 raw bytes in one
+ * 128-bit compare, so the raw guid is never unpacked.
+ *
+ * \param data              The 16-byte on-disk guid.
+ * \param target            The guid to match.
+ *
+ * \returns true if the raw guid matches the target and false otherwise.
+ */
+bool FAT32_SYM(guid_match_raw)(
+    const void* data, const FAT32_SYM(guid)* target);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_match_raw), const void* data,
+    const FAT32_SYM(guid)* target)
+        /* data must be accessible. */
+        MODEL_CHECK_OBJECT_READ(data, FAT32_GUID_BINARY_SIZE);
+        /* target must be accessible. */
+        MODEL_CHECK_OBJECT_READ(target, sizeof(*target));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_match_raw))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_match_raw), bool retval, const void* data,
+    const FAT32_SYM(guid)* target)
+        /* a match agrees with the first on-disk byte of the target. */
+        if (retval)
+        {
+            MODEL_ASSERT(
+                ((const uint8_t*)data)[0] == (uint8_t)target->data1);
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_match_raw))
+
+/**
+ * \brief Find the first matching guid in an array of raw on-disk records.
+ *
+ * \note The guid of record i starts at base + i * stride. To find the entries
+ * of a given type in a GPT partition entry array, pass the entry array as the
+ * base and the entry size as the stride. To continue a scan after a match at
+ * index i, call this again from record i + 1.
+ *
+ * \param base              The on-disk guid of the first record.
+ * \param stride            The distance in bytes between records, which must
+ *                          be at least FAT32_GUID_BINARY_SIZE.
+ * \param count             The number of records.
+ * \param target            The guid to find.
+ *
+ * \returns the index of the first matching record, or count if no record
+ * matches.
+ */
+size_t FAT32_SYM(guid_find_raw)(
+    const void* base, size_t stride, size_t count,
+    const FAT32_SYM(guid)* target);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_find_raw), const void* base, size_t stride, size_t count,
+    const FAT32_SYM(guid)* target)
+        /* the stride must cover a guid. */
+        MODEL_ASSERT(stride >= FAT32_GUID_BINARY_SIZE);
+        /* every record must be accessible. */
+        if (count > 0)
+        {
+            MODEL_CHECK_OBJECT_READ(
+                base, (count - 1) * stride + FAT32_GUID_BINARY_SIZE);
+        }
+        /* target must be accessible. */
+        MODEL_CHECK_OBJECT_READ(target, sizeof(*target));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_find_raw))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_find_raw), size_t retval, const void* base, size_t stride,
+    size_t count, const FAT32_SYM(guid)* target)
+        /* the index is in range. */
+        MODEL_ASSERT(retval <= count);
+        /* an index in range is a match. */
+        if (retval < count)
+        {
+            MODEL_ASSERT(
+                FAT32_SYM(guid_match_raw)(
+                    (const uint8_t*)base + retval * stride, target));
+        }
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_find_raw))
+
+/**
+ * \brief Insert a guid and its value into a guid map.
+ *
+ * \param map               The map.
+ * \param key               The guid to insert.
+ * \param value             The value to associate with this guid.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_MAP_DUPLICATE if the guid is already in the map.
+ *      - FAT32_ERROR_GUID_MAP_FULL if the map can't hold another entry.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_insert)(
+    FAT32_SYM(guid_map)* map, const FAT32_SYM(guid)* key, void* value);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_insert), FAT32_SYM(guid_map)* map,
+    const FAT32_SYM(guid)* key, void* value)
+        /* map must be valid. */
+        MODEL_ASSERT(FAT32_SYM(property_guid_map_valid)(map));
+        /* key must be accessible. */
+        MODEL_CHECK_OBJECT_READ(key, sizeof(*key));
+        (void)value;
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_map_insert))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_insert), int retval, FAT32_SYM(guid_map)* map)
+        /* this call either succeeds or fails with a
+         * FAT32_ERROR_GUID_MAP_DUPLICATE or a FAT32_ERROR_GUID_MAP_FULL. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GUID_MAP_DUPLICATE == retval)
+         || (FAT32_ERROR_GUID_MAP_FULL == retval));
+        /* the map is still valid. */
+        MODEL_ASSERT(FAT32_SYM(property_guid_map_valid)(map));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_map_insert))
+
+/**
+ * \brief Look up the value of a guid in a guid map.
+ *
+ * \param value             Set to the value of this guid on success.
+ * \param map               The map.
+ * \param key               The guid to find.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_MAP_NOT_FOUND if the guid isn't in the map.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_find)(
+    void** value, const FAT32_SYM(guid_map)* map,
+    const FAT32_SYM(guid)* key);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_find), void** value,
+    const FAT32_SYM(guid_map)* map, const FAT32_SYM(guid)* key)
+        /* value must be accessible. */
+        MODEL_CHECK_OBJECT_RW(value, sizeof(*value));
+        /* map must be valid. */
+        MODEL_ASSERT(FAT32_SYM(property_guid_map_valid)(map));
+        /* key must be accessible. */
+        MODEL_CHECK_OBJECT_READ(key, sizeof(*key));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_map_find))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_find), int retval)
+        /* this call either succeeds or fails with a
+         * FAT32_ERROR_GUID_MAP_NOT_FOUND. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GUID_MAP_NOT_FOUND == retval));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_map_find))
+
+/**
+ * \brief Remove a guid from a guid map.
+ *
+ * \note The following entries of the probe run are shifted back, so removal
+ * leaves no tombstones behind.
+ *
+ * \param map               The map.
+ * \param key               The guid to remove.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_MAP_NOT_FOUND if the guid isn't in the map.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_remove)(
+    FAT32_SYM(guid_map)* map, const FAT32_SYM(guid)* key);
+
+/* preconditions. */
+MODEL_CONTRACT_PRECONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_remove), FAT32_SYM(guid_map)* map,
+    const FAT32_SYM(guid)* key)
+        /* map must be valid. */
+        MODEL_ASSERT(FAT32_SYM(property_guid_map_valid)(map));
+        /* key must be accessible. */
+        MODEL_CHECK_OBJECT_READ(key, sizeof(*key));
+MODEL_CONTRACT_PRECONDITIONS_END(FAT32_SYM(guid_map_remove))
+
+/* postconditions. */
+MODEL_CONTRACT_POSTCONDITIONS_BEGIN(
+    FAT32_SYM(guid_map_remove), int retval, FAT32_SYM(guid_map)* map)
+        /* this call either succeeds or fails with a
+         * FAT32_ERROR_GUID_MAP_NOT_FOUND. */
+        MODEL_ASSERT(
+            (STATUS_SUCCESS == retval)
+         || (FAT32_ERROR_GUID_MAP_NOT_FOUND == retval));
+        /* the map is still valid. */
+        MODEL_ASSERT(FAT32_SYM(property_guid_map_valid)(map));
+MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_map_remove))
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
@@ -213,6 +918,8 @@ MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_write_to_binary))
 #define __INTERNAL_FAT32_IMPORT_guid_sym(sym) \
     FAT32_BEGIN_EXPORT \
     typedef FAT32_SYM(guid) sym ## guid; \
+    typedef FAT32_SYM(guid_map_entry) sym ## guid_map_entry; \
+    typedef FAT32_SYM(guid_map) sym ## guid_map; \
     static inline int FN_DECL_MUST_CHECK \
     sym ## guid_init_from_string( \
         FAT32_SYM(guid)* x, const char* y) { \
@@ -229,6 +936,71 @@ MODEL_CONTRACT_POSTCONDITIONS_END(FAT32_SYM(guid_write_to_binary))
     sym ## guid_write_to_binary( \
         void* x, size_t y, const FAT32_SYM(guid)* z) { \
             return FAT32_SYM(guid_write_to_binary)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_init_from_string_n( \
+        FAT32_SYM(guid)* x, size_t y, const char* z, size_t w, size_t* v) { \
+            return FAT32_SYM(guid_init_from_string_n)(x,y,z,w,v); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_init_from_data_n( \
+        FAT32_SYM(guid)* x, size_t y, const void* z, size_t w, size_t* v) { \
+            return FAT32_SYM(guid_init_from_data_n)(x,y,z,w,v); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_write_to_string_n( \
+        char* x, size_t y, const FAT32_SYM(guid)* z, size_t w, size_t* v) { \
+            return FAT32_SYM(guid_write_to_string_n)(x,y,z,w,v); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_write_to_binary_n( \
+        void* x, size_t y, const FAT32_SYM(guid)* z, size_t w, size_t* v) { \
+            return FAT32_SYM(guid_write_to_binary_n)(x,y,z,w,v); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_generate_v4( \
+        FAT32_SYM(guid)* x) { \
+            return FAT32_SYM(guid_generate_v4)(x); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_generate_v4_n( \
+        FAT32_SYM(guid)* x, size_t y) { \
+            return FAT32_SYM(guid_generate_v4_n)(x,y); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_init_from_name( \
+        FAT32_SYM(guid)* x, const FAT32_SYM(guid)* y, const void* z, \
+        size_t w) { \
+            return FAT32_SYM(guid_init_from_name)(x,y,z,w); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_map_init( \
+        FAT32_SYM(guid_map)* x, FAT32_SYM(guid_map_entry)* y, size_t z) { \
+            return FAT32_SYM(guid_map_init)(x,y,z); } \
+    static inline bool \
+    sym ## guid_equal( \
+        const FAT32_SYM(guid)* x, const FAT32_SYM(guid)* y) { \
+            return FAT32_SYM(guid_equal)(x,y); } \
+    static inline int \
+    sym ## guid_compare( \
+        const FAT32_SYM(guid)* x, const FAT32_SYM(guid)* y) { \
+            return FAT32_SYM(guid_compare)(x,y); } \
+    static inline uint64_t \
+    sym ## guid_hash( \
+        const FAT32_SYM(guid)* x) { \
+            return FAT32_SYM(guid_hash)(x); } \
+    static inline bool \
+    sym ## guid_match_raw( \
+        const void* x, const FAT32_SYM(guid)* y) { \
+            return FAT32_SYM(guid_match_raw)(x,y); } \
+    static inline size_t \
+    sym ## guid_find_raw( \
+        const void* x, size_t y, size_t z, const FAT32_SYM(guid)* w) { \
+            return FAT32_SYM(guid_find_raw)(x,y,z,w); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_map_insert( \
+        FAT32_SYM(guid_map)* x, const FAT32_SYM(guid)* y, void* z) { \
+            return FAT32_SYM(guid_map_insert)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_map_find( \
+        void** x, const FAT32_SYM(guid_map)* y, const FAT32_SYM(guid)* z) { \
+            return FAT32_SYM(guid_map_find)(x,y,z); } \
+    static inline int FN_DECL_MUST_CHECK \
+    sym ## guid_map_remove( \
+        FAT32_SYM(guid_map)* x, const FAT32_SYM(guid)* y) { \
+            return FAT32_SYM(guid_map_remove)(x,y); } \
     FAT32_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define FAT32_IMPORT_guid_as(sym) \
@@ -22,6 +22,18 @@ enum fat32_status_codes
     FAT32_ERROR_GPT_BAD_SIZE =                                              3,
     FAT32_ERROR_GPT_MBR_BAD_SIGNATURE =                                     4,
     FAT32_ERROR_GPT_BAD_RECORD =                                            5,
+    FAT32_ERROR_GUID_RANDOM_UNAVAILABLE =                                   6,
+    FAT32_ERROR_GUID_MAP_BAD_CAPACITY =                                     7,
+    FAT32_ERROR_GUID_MAP_FULL =                                             8,
+    FAT32_ERROR_GUID_MAP_DUPLICATE =                                        9,
+    FAT32_ERROR_GUID_MAP_NOT_FOUND =                                       10,
+    FAT32_ERROR_GPT_BAD_PARTITION_TYPE =                                   11,
+    FAT32_ERROR_GPT_SCAN_OPEN =                                            12,
+    FAT32_ERROR_GPT_SCAN_READ =                                            13,
+    FAT32_ERROR_GPT_SCAN_BAD_ENTRY_ARRAY =                                 14,
+    FAT32_ERROR_GPT_SCAN_OUT_OF_MEMORY =                                   15,
+    FAT32_ERROR_GPT_HEADER_BAD_SIGNATURE =                                 16,
+    FAT32_ERROR_GPT_HEADER_BAD_CRC =                                       17,
 };
 
 /* C++ compatibility. */
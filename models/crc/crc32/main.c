@@ -18,9 +18,9 @@ size_t input_size()
 {
     size_t retval = nondet_size();
 
-    if (retval > 10)
+    if (retval > 40)
     {
-        retval = 10;
+        retval = 40;
     }
 
     return retval;
@@ -31,7 +31,7 @@ int main(int argc, char* argv[])
     (void)argc;
     (void)argv;
     int retval;
-    uint8_t data[10];
+    uint8_t data[40];
 
     __CPROVER_havoc_object(data);
 
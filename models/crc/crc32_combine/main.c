@@ -0,0 +1,27 @@
+/**
+ * \file models/crc/crc32_combine/main.c
+ *
+ * \brief Model checks for \ref crc32_combine.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/model_check/assert.h>
+
+FAT32_IMPORT_crc;
+
+uint32_t nondet_crc();
+uint64_t nondet_len();
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+
+    /* combine arbitrary CRC-32 values. */
+    uint32_t value = crc32_combine(nondet_crc(), nondet_crc(), nondet_len());
+
+    return 0;
+}
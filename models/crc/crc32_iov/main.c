@@ -0,0 +1,50 @@
+/**
+ * \file models/crc/crc32_iov/main.c
+ *
+ * \brief Model checks for \ref crc32_iov.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/model_check/assert.h>
+
+FAT32_IMPORT_crc;
+
+size_t nondet_size();
+
+size_t input_size(size_t max)
+{
+    size_t retval = nondet_size();
+
+    if (retval > max)
+    {
+        retval = max;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t first[20];
+    uint8_t second[20];
+    struct iovec iov[2];
+
+    __CPROVER_havoc_object(first);
+    __CPROVER_havoc_object(second);
+
+    /* build a vector over two sections. */
+    iov[0].iov_base = first;
+    iov[0].iov_len = input_size(sizeof(first));
+    iov[1].iov_base = second;
+    iov[1].iov_len = input_size(sizeof(second));
+
+    /* perform a vectored CRC of this data. */
+    uint32_t value = crc32_iov(iov, input_size(2));
+
+    return 0;
+}
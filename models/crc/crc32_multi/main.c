@@ -0,0 +1,56 @@
+/**
+ * \file models/crc/crc32_multi/main.c
+ *
+ * \brief Model checks for \ref crc32_multi.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/model_check/assert.h>
+
+FAT32_IMPORT_crc;
+
+size_t nondet_size();
+
+size_t input_size(size_t max)
+{
+    size_t retval = nondet_size();
+
+    if (retval > max)
+    {
+        retval = max;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t data[5][20];
+    const void* bufs[5];
+    size_t sizes[5];
+    uint32_t out[5];
+
+    __CPROVER_havoc_object(data);
+
+    /* build a batch of one group and one remaining section. */
+    bufs[0] = data[0];
+    sizes[0] = input_size(sizeof(data[0]));
+    bufs[1] = data[1];
+    sizes[1] = input_size(sizeof(data[1]));
+    bufs[2] = data[2];
+    sizes[2] = input_size(sizeof(data[2]));
+    bufs[3] = data[3];
+    sizes[3] = input_size(sizeof(data[3]));
+    bufs[4] = data[4];
+    sizes[4] = input_size(sizeof(data[4]));
+
+    /* perform a multi-buffer CRC of this data. */
+    crc32_multi(bufs, sizes, out, input_size(5));
+
+    return 0;
+}
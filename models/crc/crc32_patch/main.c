@@ -0,0 +1,55 @@
+/**
+ * \file models/crc/crc32_patch/main.c
+ *
+ * \brief Model checks for \ref crc32_patch.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/model_check/assert.h>
+
+FAT32_IMPORT_crc;
+
+uint32_t nondet_crc();
+uint64_t nondet_len();
+size_t nondet_size();
+
+size_t input_size()
+{
+    size_t retval = nondet_size();
+
+    if (retval > 40)
+    {
+        retval = 40;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t old_bytes[40];
+    uint8_t new_bytes[40];
+
+    __CPROVER_havoc_object(old_bytes);
+    __CPROVER_havoc_object(new_bytes);
+
+    /* place the patch somewhere in a section of arbitrary size. */
+    size_t n = input_size();
+    uint64_t total_len = nondet_len();
+    uint64_t offset = nondet_len();
+    if (offset > total_len || n > total_len - offset)
+    {
+        return 0;
+    }
+
+    /* patch an arbitrary CRC-32. */
+    uint32_t value =
+        crc32_patch(nondet_crc(), total_len, offset, old_bytes, new_bytes, n);
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/**
+ * \file models/crc/crc32_update/main.c
+ *
+ * \brief Model checks for \ref crc32_init, \ref crc32_update, and
+ * \ref crc32_final.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/model_check/assert.h>
+
+FAT32_IMPORT_crc;
+
+size_t nondet_size();
+
+size_t input_size(size_t max)
+{
+    size_t retval = nondet_size();
+
+    if (retval > max)
+    {
+        retval = max;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    crc32_state state;
+    uint8_t data[40];
+
+    __CPROVER_havoc_object(data);
+
+    /* split the data into two updates. */
+    size_t first = input_size(sizeof(data));
+    size_t second = input_size(sizeof(data) - first);
+
+    /* perform a streaming CRC of this data. */
+    crc32_init(&state);
+    crc32_update(&state, data, first);
+    crc32_update(&state, data + first, second);
+    uint32_t value = crc32_final(&state);
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/**
+ * \file models/gpt/gpt_header_init/main.c
+ *
+ * \brief Model checks for \ref gpt_header_init.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+
+FAT32_IMPORT_guid;
+FAT32_IMPORT_gpt;
+
+uint64_t nondet_lba();
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    gpt_header header;
+    guid disk_guid;
+    uint64_t first_lba = nondet_lba();
+    uint64_t last_lba = nondet_lba();
+    uint64_t alt_lba = nondet_lba();
+
+    __CPROVER_havoc_object(&disk_guid);
+
+    /* the lbas must be in order. */
+    MODEL_ASSUME(last_lba > first_lba);
+    MODEL_ASSUME(alt_lba > last_lba);
+
+    /* initialize the header. */
+    retval = gpt_header_init(&header, &disk_guid, first_lba, last_lba, alt_lba);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* this method only fails with a bad size error. */
+        MODEL_ASSERT(FAT32_ERROR_GPT_BAD_SIZE == retval);
+        return 1;
+    }
+
+    /* the primary header and its array come before the first usable lba. */
+    MODEL_ASSERT(header.partition_entry_lba > header.my_lba);
+    MODEL_ASSERT(header.partition_entry_lba + 32 <= first_lba);
+
+    return 0;
+}
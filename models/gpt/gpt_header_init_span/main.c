@@ -0,0 +1,47 @@
+/**
+ * \file models/gpt/gpt_header_init_span/main.c
+ *
+ * \brief Model checks for \ref gpt_header_init_span.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+
+FAT32_IMPORT_guid;
+FAT32_IMPORT_gpt;
+
+uint64_t nondet_lba();
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    gpt_header header;
+    guid disk_guid;
+    uint64_t start_lba = nondet_lba();
+    uint64_t end_lba = nondet_lba();
+
+    __CPROVER_havoc_object(&disk_guid);
+
+    /* the disk must end after it starts. */
+    MODEL_ASSUME(end_lba > start_lba);
+
+    /* initialize the header. */
+    retval = gpt_header_init_span(&header, &disk_guid, start_lba, end_lba);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* this method only fails with a bad size error. */
+        MODEL_ASSERT(FAT32_ERROR_GPT_BAD_SIZE == retval);
+        return 1;
+    }
+
+    /* the backup header is at the end of the disk. */
+    MODEL_ASSERT(end_lba == header.alternative_lba);
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * \file models/gpt/gpt_header_write/main.c
+ *
+ * \brief Model checks for \ref gpt_header_write.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+
+FAT32_IMPORT_gpt;
+
+size_t nondet_size();
+
+size_t record_size()
+{
+    size_t ret = nondet_size();
+    if (ret > 600)
+    {
+        ret = 600;
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    uint8_t data[600];
+    gpt_header header;
+
+    __CPROVER_havoc_object(&header);
+    MODEL_ASSUME(property_gpt_header_valid(&header));
+
+    /* write the header. */
+    retval = gpt_header_write(data, record_size(), &header);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* this method only fails with a bad size error. */
+        MODEL_ASSERT(FAT32_ERROR_GPT_BAD_SIZE == retval);
+        return 1;
+    }
+
+    /* the signature starts the region. */
+    MODEL_ASSERT('E' == data[0]);
+
+    return 0;
+}
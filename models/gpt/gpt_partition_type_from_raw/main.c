@@ -0,0 +1,41 @@
+/**
+ * \file models/gpt/gpt_partition_type_from_raw/main.c
+ *
+ * \brief Model checks for \ref gpt_partition_type_from_raw and
+ * \ref gpt_partition_type_guid.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+
+FAT32_IMPORT_gpt;
+FAT32_IMPORT_guid;
+
+int nondet_type();
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t raw[FAT32_GUID_BINARY_SIZE];
+    guid id;
+
+    /* classify an arbitrary guid. */
+    gpt_partition_type type = gpt_partition_type_from_raw(raw);
+    MODEL_ASSERT(
+        type >= FAT32_GPT_PARTITION_TYPE_UNKNOWN
+     && type < FAT32_GPT_PARTITION_TYPE_COUNT);
+
+    /* look up the guid of an arbitrary type. */
+    int retval =
+        gpt_partition_type_guid(&id, (gpt_partition_type)nondet_type());
+    MODEL_ASSERT(
+        STATUS_SUCCESS == retval
+     || FAT32_ERROR_GPT_BAD_PARTITION_TYPE == retval);
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+/**
+ * \file models/gpt/gpt_probe/main.c
+ *
+ * \brief Model checks for \ref gpt_probe.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+
+FAT32_IMPORT_gpt;
+
+size_t nondet_size();
+
+size_t image_size()
+{
+    size_t ret = nondet_size();
+    if (ret > 1100)
+    {
+        ret = 1100;
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t data[1100];
+    gpt_protective_mbr mbr;
+    size_t size = image_size();
+
+    gpt_probe_result result = gpt_probe(data, size);
+
+    /* the probe never rejects an mbr that a full read accepts. */
+    if (
+        size >= FAT32_GPT_PROBE_MINIMUM_SIZE
+     && STATUS_SUCCESS == gpt_protective_mbr_read(&mbr, data, size))
+    {
+        MODEL_ASSERT(result >= FAT32_GPT_PROBE_NO_HEADER);
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file models/gpt/gpt_protective_mbr_view_init/main.c
+ *
+ * \brief Model checks for \ref gpt_protective_mbr_view_init.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+#include <string.h>
+
+FAT32_IMPORT_gpt;
+
+size_t nondet_size();
+
+size_t record_size()
+{
+    size_t ret = nondet_size();
+    if (ret > 600)
+    {
+        ret = 600;
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t data[600];
+    gpt_protective_mbr mbr;
+    gpt_protective_mbr_view view;
+    size_t size = record_size();
+
+    /* validating in place agrees with reading the mbr. */
+    int read_status = gpt_protective_mbr_read(&mbr, data, size);
+    int view_status = gpt_protective_mbr_view_init(&view, data, size);
+    MODEL_ASSERT(read_status == view_status);
+    if (STATUS_SUCCESS != view_status)
+    {
+        return 1;
+    }
+
+    /* the view reads the same fields as the mbr. */
+    MODEL_ASSERT(mbr.signature == gpt_protective_mbr_view_signature(&view));
+    for (size_t i = 0; i < 4; ++i)
+    {
+        const gpt_protective_mbr_partition_record* rec =
+            &mbr.partition_record[i];
+
+        MODEL_ASSERT(
+            rec->starting_chs
+                == gpt_protective_mbr_view_record_starting_chs(&view, i));
+        MODEL_ASSERT(
+            rec->os_type == gpt_protective_mbr_view_record_os_type(&view, i));
+        MODEL_ASSERT(
+            rec->ending_chs
+                == gpt_protective_mbr_view_record_ending_chs(&view, i));
+        MODEL_ASSERT(
+            rec->size_in_lba
+                == gpt_protective_mbr_view_record_size_in_lba(&view, i));
+    }
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+/**
+ * \file models/gpt/gpt_protective_mbr_write_span/main.c
+ *
+ * \brief Model checks for \ref gpt_protective_mbr_write_span.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/gpt.h>
+
+FAT32_IMPORT_gpt;
+
+size_t nondet_size();
+
+size_t record_size()
+{
+    size_t ret = nondet_size();
+    if (ret > 600)
+    {
+        ret = 600;
+    }
+
+    return ret;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t data[600];
+    gpt_protective_mbr mbr;
+    size_t size = record_size();
+    size_t disk_size = nondet_size();
+
+    int retval = gpt_protective_mbr_write_span(data, size, disk_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return 1;
+    }
+
+    /* the written sector reads back as a valid protective mbr. */
+    MODEL_ASSERT(STATUS_SUCCESS == gpt_protective_mbr_read(&mbr, data, size));
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+/**
+ * \file models/guid/guid_compare/main.c
+ *
+ * \brief Model checks for \ref guid_compare and \ref guid_equal.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    guid lhs;
+    guid rhs;
+
+    /* the order is antisymmetric. */
+    int order = guid_compare(&lhs, &rhs);
+    int reverse = guid_compare(&rhs, &lhs);
+    MODEL_ASSERT((order < 0) == (reverse > 0));
+    MODEL_ASSERT((0 == order) == guid_equal(&rhs, &lhs));
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file models/guid/guid_find_raw/main.c
+ *
+ * \brief Model checks for \ref guid_find_raw.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+#define RECORD_COUNT                                                        3
+#define RECORD_STRIDE                                                      32
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    uint8_t records[RECORD_COUNT * RECORD_STRIDE];
+    guid target;
+
+    size_t index =
+        guid_find_raw(records, RECORD_STRIDE, RECORD_COUNT, &target);
+
+    /* no record before the index matches. */
+    for (size_t i = 0; i < index; ++i)
+    {
+        MODEL_ASSERT(!guid_match_raw(records + i * RECORD_STRIDE, &target));
+    }
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * \file models/guid/guid_generate_v4/main.c
+ *
+ * \brief Model checks for \ref guid_generate_v4.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+static size_t nondet_size();
+
+static size_t guid_count()
+{
+    size_t retval = nondet_size();
+
+    if (retval > 2)
+    {
+        retval = 2;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    guid id;
+    guid ids[2];
+
+    /* generate a single guid. */
+    retval = guid_generate_v4(&id);
+    if (STATUS_SUCCESS != retval)
+    {
+        MODEL_ASSERT(FAT32_ERROR_GUID_RANDOM_UNAVAILABLE == retval);
+        return 1;
+    }
+
+    /* generate an array of guids. */
+    retval = guid_generate_v4_n(ids, guid_count());
+    if (STATUS_SUCCESS != retval)
+    {
+        MODEL_ASSERT(FAT32_ERROR_GUID_RANDOM_UNAVAILABLE == retval);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+/**
+ * \file models/guid/guid_init_from_name/main.c
+ *
+ * \brief Model checks for \ref guid_init_from_name.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+#define MAX_NAME_SIZE 8
+
+static size_t nondet_size();
+
+static size_t name_size()
+{
+    size_t retval = nondet_size();
+
+    if (retval > MAX_NAME_SIZE)
+    {
+        retval = MAX_NAME_SIZE;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    guid ns;
+    guid id;
+    uint8_t name[MAX_NAME_SIZE];
+
+    /* derive a guid from an arbitrary namespace and name. */
+    retval = guid_init_from_name(&id, &ns, name, name_size());
+    MODEL_ASSERT(STATUS_SUCCESS == retval);
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file models/guid/guid_init_from_string_n/main.c
+ *
+ * \brief Model checks for \ref guid_init_from_string_n.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+static size_t nondet_size();
+
+static size_t bounded_size(size_t max)
+{
+    size_t retval = nondet_size();
+
+    if (retval > max)
+    {
+        retval = max;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    size_t failed_index;
+    guid ids[2];
+    char strings[80];
+
+    /* randomize input strings. */
+    __CPROVER_havoc_object(strings);
+
+    /* initialize the guids. */
+    retval =
+        guid_init_from_string_n(
+            ids, bounded_size(2), strings, bounded_size(sizeof(strings)),
+            &failed_index);
+    if (STATUS_SUCCESS != retval)
+    {
+        MODEL_ASSERT(FAT32_ERROR_GUID_STRING_BAD == retval);
+        return 1;
+    }
+
+    return 0;
+}
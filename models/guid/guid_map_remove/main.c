@@ -0,0 +1,58 @@
+/**
+ * \file models/guid/guid_map_remove/main.c
+ *
+ * \brief Model checks for the \ref guid_map operations.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+#define CAPACITY 4
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    guid_map_entry entries[CAPACITY];
+    guid_map map;
+    guid keys[3];
+    int values[3];
+    void* value;
+
+    retval = guid_map_init(&map, entries, CAPACITY);
+    MODEL_ASSERT(STATUS_SUCCESS == retval);
+
+    /* insert arbitrary, possibly equal, keys. */
+    for (int i = 0; i < 3; ++i)
+    {
+        retval = guid_map_insert(&map, keys + i, values + i);
+        MODEL_ASSERT(
+            STATUS_SUCCESS == retval
+         || FAT32_ERROR_GUID_MAP_DUPLICATE == retval);
+    }
+
+    /* remove the first key, then the others must still be found. */
+    retval = guid_map_remove(&map, keys + 0);
+    MODEL_ASSERT(STATUS_SUCCESS == retval);
+
+    retval = guid_map_find(&value, &map, keys + 0);
+    MODEL_ASSERT(FAT32_ERROR_GUID_MAP_NOT_FOUND == retval);
+
+    for (int i = 1; i < 3; ++i)
+    {
+        if (!guid_equal(keys + i, keys + 0))
+        {
+            retval = guid_map_find(&value, &map, keys + i);
+            MODEL_ASSERT(STATUS_SUCCESS == retval);
+        }
+    }
+
+    return 0;
+}
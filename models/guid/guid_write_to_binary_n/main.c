@@ -0,0 +1,54 @@
+/**
+ * \file models/guid/guid_write_to_binary_n/main.c
+ *
+ * \brief Model checks for \ref guid_write_to_binary_n.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/model_check/assert.h>
+#include <libfat32/status.h>
+#include <libfat32/guid.h>
+
+FAT32_IMPORT_guid;
+
+static size_t nondet_size();
+
+static size_t bounded_size(size_t max)
+{
+    size_t retval = nondet_size();
+
+    if (retval > max)
+    {
+        retval = max;
+    }
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    int retval;
+    size_t failed_index;
+    guid ids[2];
+    uint8_t data[40];
+
+    /* randomize the guids. */
+    __CPROVER_havoc_object(ids);
+
+    /* write the guids. */
+    retval =
+        guid_write_to_binary_n(
+            data, bounded_size(sizeof(data)), ids, bounded_size(2),
+            &failed_index);
+    if (STATUS_SUCCESS != retval)
+    {
+        MODEL_ASSERT(FAT32_ERROR_GUID_DATA_INVALID_SIZE == retval);
+        return 1;
+    }
+
+    return 0;
+}
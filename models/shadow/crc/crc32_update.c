@@ -0,0 +1,33 @@
+/**
+ * \file shadow/crc/crc32_update.c
+ *
+ * \brief Shadow impl of crc32_update.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+uint32_t nondet_uint32();
+
+/**
+ * \brief Add a section of memory to a CRC-32 state.
+ *
+ * \param state         The state to update.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ */
+void FAT32_SYM(crc32_update)(
+    FAT32_SYM(crc32_state)* state, const void* data, size_t size)
+{
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(crc32_update), state, data, size);
+
+    state->crc = nondet_uint32();
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_update), state, data, size);
+}
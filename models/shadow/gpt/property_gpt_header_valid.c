@@ -0,0 +1,66 @@
+/**
+ * \file models/shadow/gpt/property_gpt_header_valid.c
+ *
+ * \brief Verify that a given GPT header is valid.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <string.h>
+
+/**
+ * \brief Returns true if the given gpt header is valid.
+ *
+ * \note A valid gpt header has a valid signature and sane defaults. There isn't
+ * much more we can do to verify it.
+ *
+ * \param hdr           The header to check.
+ *
+ * \returns true if this record is valid and false otherwise.
+ */
+bool FAT32_SYM(property_gpt_header_valid)(
+    const FAT32_SYM(gpt_header)* hdr)
+{
+    MODEL_CHECK_OBJECT_READ(hdr, sizeof(*hdr));
+
+    /* verify the signature. */
+    if (
+        0 != memcmp(
+                hdr->signature, FAT32_GPT_HEADER_SIGNATURE,
+                FAT32_GPT_HEADER_SIGNATURE_SIZE))
+    {
+        return false;
+    }
+
+    /* the header holds at least the fields that we know about. */
+    if (hdr->header_size < FAT32_GPT_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    /* neither header can be in the protective MBR. */
+    if (0 == hdr->my_lba || 0 == hdr->alternative_lba)
+    {
+        return false;
+    }
+
+    /* the usable lbas must be a range. */
+    if (hdr->first_usable_lba > hdr->last_usable_lba)
+    {
+        return false;
+    }
+
+    /* entries are 128 << n bytes. */
+    if (
+        hdr->size_of_partition_entry < 128
+     || 0 != (hdr->size_of_partition_entry
+                & (hdr->size_of_partition_entry - 1)))
+    {
+        return false;
+    }
+
+    /* if all of these tests pass, the header must be valid. */
+    return true;
+}
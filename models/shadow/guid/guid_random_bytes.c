@@ -0,0 +1,46 @@
+/**
+ * \file models/shadow/guid/guid_random_bytes.c
+ *
+ * \brief Shadow method for guid_random_bytes.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/model_check/memory.h>
+
+#include "../../../src/guid/guid_internal.h"
+
+static int nondet_retval();
+
+/**
+ * \brief Fill a buffer with cryptographically secure random bytes.
+ *
+ * \param buffer            The buffer to fill.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_RANDOM_UNAVAILABLE if the generator can't be seeded.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_random_bytes)(void* buffer, size_t size)
+{
+    int retval;
+
+    /* the buffer must be accessible. */
+    MODEL_CHECK_OBJECT_WRITE(buffer, size);
+
+    retval = nondet_retval();
+    if (STATUS_SUCCESS == retval)
+    {
+        __CPROVER_havoc_object(buffer);
+    }
+    else
+    {
+        retval = FAT32_ERROR_GUID_RANDOM_UNAVAILABLE;
+    }
+
+    return retval;
+}
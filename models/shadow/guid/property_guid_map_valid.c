@@ -0,0 +1,43 @@
+/**
+ * \file models/shadow/guid/property_guid_map_valid.c
+ *
+ * \brief Verify that a given guid map is valid.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+
+#include "../../../src/guid/guid_internal.h"
+
+/**
+ * \brief Returns true if the given guid map is valid.
+ *
+ * \param map           The map to check.
+ *
+ * \returns true if this map is valid and false otherwise.
+ */
+bool FAT32_SYM(property_guid_map_valid)(
+    const FAT32_SYM(guid_map)* map)
+{
+    MODEL_CHECK_OBJECT_READ(map, sizeof(*map));
+
+    /* the capacity must be a non-zero power of two. */
+    if (0 == map->capacity || 0 != (map->capacity & (map->capacity - 1)))
+    {
+        return false;
+    }
+
+    /* the slot array must be accessible. */
+    MODEL_CHECK_OBJECT_RW(
+        map->entries, map->capacity * sizeof(*map->entries));
+
+    /* the map can't hold more than its maximum count. */
+    if (map->count > FAT32_GUID_MAP_MAX_COUNT(map->capacity))
+    {
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file models/shadow/guid/property_guid_valid.c
+ *
+ * \brief Verify that a given guid is valid.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+
+/**
+ * \brief Returns true if the given guid is valid.
+ *
+ * \note Any 128-bit value is a guid, so a guid is valid if it is accessible.
+ *
+ * \param id            The guid to check.
+ *
+ * \returns true if this guid is valid and false otherwise.
+ */
+bool FAT32_SYM(property_guid_valid)(
+    const FAT32_SYM(guid)* id)
+{
+    MODEL_CHECK_OBJECT_READ(id, sizeof(*id));
+
+    return true;
+}
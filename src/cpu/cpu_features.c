@@ -0,0 +1,134 @@
+/**
+ * \file cpu/cpu_features.c
+ *
+ * \brief Detect the features of the host CPU.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdatomic.h>
+
+#include "cpu_internal.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+# include <cpuid.h>
+#endif
+
+/* set once detection has run, so that a host with no features is cached. */
+#define CPU_FEATURES_DETECTED 0x80000000
+
+static _Atomic uint32_t cached_features = 0;
+
+/* XCR0 state components: SSE, AVX, and the three AVX-512 components. */
+#define XCR0_AVX_STATE 0x06
+#define XCR0_AVX512_STATE 0xE6
+
+/* forward decls. */
+static uint32_t detect_features(void);
+
+/**
+ * \brief Get the features of the host CPU.
+ *
+ * \note Features are detected on the first call and cached afterward. On hosts
+ * without feature detection, and under model checking, no features are
+ * reported.
+ *
+ * \returns a bitset of \ref fat32_cpu_feature_flags.
+ */
+uint32_t FAT32_SYM(cpu_features)(void)
+{
+    uint32_t features =
+        atomic_load_explicit(&cached_features, memory_order_relaxed);
+
+    /* detection is idempotent, so racing threads store the same value. */
+    if (0 == features)
+    {
+        features = detect_features() | CPU_FEATURES_DETECTED;
+        atomic_store_explicit(
+            &cached_features, features, memory_order_relaxed);
+    }
+
+    return features & ~CPU_FEATURES_DETECTED;
+}
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+/**
+ * \brief Query cpuid for the features this library uses.
+ *
+ * \returns a bitset of \ref fat32_cpu_feature_flags.
+ */
+static uint32_t detect_features(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    uint32_t features = 0;
+    uint64_t xcr0 = 0;
+
+    /* leaf 1 holds the SSE family and carry-less multiply features. */
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return 0;
+    }
+
+    if ((ecx & bit_PCLMUL) && (ecx & bit_SSSE3))
+    {
+        features |= FAT32_CPU_FEATURE_PCLMUL;
+    }
+
+    if (ecx & bit_SSSE3)
+    {
+        features |= FAT32_CPU_FEATURE_SSSE3;
+    }
+
+    if (ecx & bit_SSE4_2)
+    {
+        features |= FAT32_CPU_FEATURE_SSE42;
+    }
+
+    /* wide vector state is only usable if the OS saves it. */
+    if (ecx & bit_OSXSAVE)
+    {
+        unsigned int lo, hi;
+        __asm__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+        xcr0 = ((uint64_t)hi << 32) | lo;
+    }
+
+    /* leaf 7 holds the AVX-512 and vector carry-less multiply features. */
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    {
+        return features;
+    }
+
+    if (
+        (XCR0_AVX512_STATE == (xcr0 & XCR0_AVX512_STATE))
+     && (ebx & bit_AVX512F)
+     && (ebx & bit_AVX512BW)
+     && (ebx & bit_AVX512VL))
+    {
+        features |= FAT32_CPU_FEATURE_AVX512;
+    }
+
+    if (
+        (XCR0_AVX_STATE == (xcr0 & XCR0_AVX_STATE))
+     && (ecx & bit_VPCLMULQDQ))
+    {
+        features |= FAT32_CPU_FEATURE_VPCLMUL;
+    }
+
+    return features;
+}
+
+#else
+
+/**
+ * \brief Report no features on hosts without feature detection.
+ *
+ * \returns zero.
+ */
+static uint32_t detect_features(void)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * \file cpu/cpu_internal.h
+ *
+ * \brief Internal host CPU feature detection.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libfat32/function_decl.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Host CPU features that select optimized kernels.
+ *
+ * \note FAT32_CPU_FEATURE_PCLMUL is only reported alongside SSSE3, which the
+ * carry-less multiply kernels use to shuffle partial lanes.
+ */
+enum fat32_cpu_feature_flags
+{
+    FAT32_CPU_FEATURE_PCLMUL =                                         0x0001,
+    FAT32_CPU_FEATURE_AVX512 =                                         0x0002,
+    FAT32_CPU_FEATURE_VPCLMUL =                                        0x0004,
+    FAT32_CPU_FEATURE_SSE42 =                                          0x0008,
+    FAT32_CPU_FEATURE_SSSE3 =                                          0x0010,
+};
+
+/**
+ * \brief Get the features of the host CPU.
+ *
+ * \note Features are detected on the first call and cached afterward. On hosts
+ * without feature detection, and under model checking, no features are
+ * reported.
+ *
+ * \returns a bitset of \ref fat32_cpu_feature_flags.
+ */
+uint32_t FAT32_SYM(cpu_features)(void);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -10,6 +10,8 @@
 
 #include <libfat32/crc.h>
 
+#include "crc32_internal.h"
+
 /**
  * \brief Calculates the CRC-32 of a given section of memory.
  *
@@ -25,12 +27,7 @@ uint32_t FAT32_SYM(crc32)(const void* data, size_t size)
     /* function contract preconditions. */
     MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(crc32), data, size);
 
-    const uint8_t* bdata = (const uint8_t*)data;
-    for (size_t i = 0; i < size; ++i)
-    {
-        int offset = (crc ^ bdata[i]) & 0xFF;
-        crc = FAT32_SYM(crc32_constants)[offset] ^ (crc >> 8);
-    }
+    crc = FAT32_SYM(crc32_kernel)(crc, data, size);
 
     crc ^= 0xffffffff;
 
@@ -0,0 +1,45 @@
+/**
+ * \file crc/crc32_combine.c
+ *
+ * \brief Combine the CRC-32 values of two adjacent sections of memory.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Combine the CRC-32 values of two adjacent sections of memory.
+ *
+ * \note CRC-32 is linear, so the CRC-32 of A followed by B is the CRC-32 of A
+ * run through len_b zero bytes, plus the CRC-32 of B. The initial and final
+ * inversions cancel out.
+ *
+ * \param crc_a         The CRC-32 of the first section.
+ * \param crc_b         The CRC-32 of the second section.
+ * \param len_b         The size of the second section in bytes.
+ *
+ * \returns the CRC-32 of the first section followed by the second section.
+ */
+uint32_t FAT32_SYM(crc32_combine)(
+    uint32_t crc_a, uint32_t crc_b, uint64_t len_b)
+{
+    uint32_t crc;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(crc32_combine), crc_a, crc_b, len_b);
+
+    crc =
+        FAT32_SYM(crc32_multmodp)(FAT32_SYM(crc32_x8nmodp)(len_b), crc_a)
+      ^ crc_b;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_combine), crc, crc_a, crc_b, len_b);
+
+    return crc;
+}
@@ -0,0 +1,62 @@
+/**
+ * \file crc/crc32_copy.c
+ *
+ * \brief Copy a section of memory and calculate its CRC-32 in one pass.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+#include "../cpu/cpu_internal.h"
+#include "crc32_internal.h"
+
+/* forward decls. */
+static FAT32_SYM(crc32_copy_kernel_fn) copy_kernel(void);
+
+/**
+ * \brief Copy a section of memory and calculate its CRC-32 in one pass.
+ *
+ * \param dst           The destination buffer.
+ * \param src           The source buffer.
+ * \param size          The number of bytes to copy.
+ *
+ * \returns the CRC-32 of the copied bytes.
+ */
+uint32_t FAT32_SYM(crc32_copy)(void* dst, const void* src, size_t size)
+{
+    uint32_t crc = 0xffffffff;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(crc32_copy), dst, src, size);
+
+    crc = copy_kernel()(crc, dst, src, size);
+
+    crc ^= 0xffffffff;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_copy), crc, dst, src, size);
+
+    return crc;
+}
+
+/**
+ * \brief Get the best copy kernel for this host.
+ *
+ * \note Host features are cached, so this is cheap to call on every copy.
+ *
+ * \returns the copy kernel.
+ */
+static FAT32_SYM(crc32_copy_kernel_fn) copy_kernel(void)
+{
+#if defined(__x86_64__) && !defined(CBMC)
+    if (FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_PCLMUL)
+    {
+        return &FAT32_SYM(crc32_copy_kernel_pclmul);
+    }
+#endif
+
+    return &FAT32_SYM(crc32_copy_kernel_chunked);
+}
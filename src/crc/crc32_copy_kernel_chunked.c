@@ -0,0 +1,54 @@
+/**
+ * \file crc/crc32_copy_kernel_chunked.c
+ *
+ * \brief Portable fused copy and CRC-32 kernel.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "crc32_internal.h"
+
+/* the size of each chunk, which must fit comfortably in the L1 cache. */
+#define CRC32_COPY_CHUNK_SIZE 4096
+
+/**
+ * \brief Copy a buffer and update a raw CRC-32 register over it, one chunk at a
+ * time.
+ *
+ * \note Each chunk is copied, then its CRC-32 is computed from the copy while
+ * the copy is still in the L1 cache, so each byte is read from memory once.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param dst           The destination buffer.
+ * \param src           The source buffer.
+ * \param size          The number of bytes to copy.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+uint32_t FAT32_SYM(crc32_copy_kernel_chunked)(
+    uint32_t crc, void* dst, const void* src, size_t size)
+{
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+
+    while (size > 0)
+    {
+        size_t chunk = size;
+        if (chunk > CRC32_COPY_CHUNK_SIZE)
+        {
+            chunk = CRC32_COPY_CHUNK_SIZE;
+        }
+
+        memcpy(d, s, chunk);
+        crc = FAT32_SYM(crc32_kernel)(crc, d, chunk);
+
+        d += chunk;
+        s += chunk;
+        size -= chunk;
+    }
+
+    return crc;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file crc/crc32_copy_kernel_pclmul.c
+ *
+ * \brief Carry-less multiply folding fused copy and CRC-32 kernel for x86-64.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "crc32_pclmul.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+/**
+ * \brief Store a lane to an aligned destination.
+ *
+ * \param d             The destination, aligned to 16 bytes.
+ * \param x             The lane to store.
+ * \param stream        If true, bypass the cache with a non-temporal store.
+ */
+static inline FAT32_CRC32_PCLMUL_TARGET void store128(
+    uint8_t* d, __m128i x, bool stream)
+{
+    if (stream)
+    {
+        _mm_stream_si128((__m128i*)d, x);
+    }
+    else
+    {
+        _mm_store_si128((__m128i*)d, x);
+    }
+}
+
+/**
+ * \brief Copy a buffer and update a raw CRC-32 register over it using
+ * carry-less multiply folding.
+ *
+ * \note Each 64-byte block is loaded once, stored to the destination, and
+ * folded into the accumulators. Copies of at least
+ * \ref FAT32_CRC32_COPY_STREAM_THRESHOLD bytes use non-temporal stores, so that
+ * the destination doesn't evict the working set.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param dst           The destination buffer.
+ * \param src           The source buffer.
+ * \param size          The number of bytes to copy.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+FAT32_CRC32_PCLMUL_TARGET
+uint32_t FAT32_SYM(crc32_copy_kernel_pclmul)(
+    uint32_t crc, void* dst, const void* src, size_t size)
+{
+    uint8_t* d = (uint8_t*)dst;
+    const uint8_t* s = (const uint8_t*)src;
+    bool stream = size >= FAT32_CRC32_COPY_STREAM_THRESHOLD;
+    __m128i x0, x1, x2, x3, x4;
+
+    /* short copies can't fill the four folding lanes after alignment. */
+    if (size < 128)
+    {
+        memcpy(d, s, size);
+        return FAT32_SYM(crc32_kernel_slice16)(crc, s, size);
+    }
+
+    /* align the destination so that every lane store is aligned. */
+    size_t head = (16 - ((uintptr_t)d & 15)) & 15;
+    memcpy(d, s, head);
+    crc = FAT32_SYM(crc32_kernel_slice16)(crc, s, head);
+    d += head;
+    s += head;
+    size -= head;
+
+    /* copy the first four lanes, adding the CRC register to the first. */
+    x1 = _mm_loadu_si128((const __m128i*)(s + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(s + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(s + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(s + 0x30));
+    store128(d + 0x00, x1, stream);
+    store128(d + 0x10, x2, stream);
+    store128(d + 0x20, x3, stream);
+    store128(d + 0x30, x4, stream);
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    d += 64;
+    s += 64;
+    size -= 64;
+
+    /* copy and fold 64 bytes per iteration across four independent lanes. */
+    x0 = _mm_loadu_si128((const __m128i*)crc32_pclmul_k1k2);
+    while (size >= 64)
+    {
+        __m128i y1 = _mm_loadu_si128((const __m128i*)(s + 0x00));
+        __m128i y2 = _mm_loadu_si128((const __m128i*)(s + 0x10));
+        __m128i y3 = _mm_loadu_si128((const __m128i*)(s + 0x20));
+        __m128i y4 = _mm_loadu_si128((const __m128i*)(s + 0x30));
+        store128(d + 0x00, y1, stream);
+        store128(d + 0x10, y2, stream);
+        store128(d + 0x20, y3, stream);
+        store128(d + 0x30, y4, stream);
+        x1 = crc32_pclmul_fold(x1, x0, y1);
+        x2 = crc32_pclmul_fold(x2, x0, y2);
+        x3 = crc32_pclmul_fold(x3, x0, y3);
+        x4 = crc32_pclmul_fold(x4, x0, y4);
+        d += 64;
+        s += 64;
+        size -= 64;
+    }
+
+    /* order the non-temporal stores before any later stores. */
+    if (stream)
+    {
+        _mm_sfence();
+    }
+
+    /* fold the four lanes into one. */
+    x0 = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+    x1 = crc32_pclmul_fold(x1, x0, x2);
+    x1 = crc32_pclmul_fold(x1, x0, x3);
+    x1 = crc32_pclmul_fold(x1, x0, x4);
+
+    /* copy the tail, then finish the CRC over it. */
+    memcpy(d, s, size);
+
+    return FAT32_SYM(crc32_pclmul_finish)(x1, s, size);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * \file crc/crc32_final.c
+ *
+ * \brief Get the CRC-32 of a CRC-32 state.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+/**
+ * \brief Get the CRC-32 of all sections added to a CRC-32 state.
+ *
+ * \param state         The state to finalize.
+ *
+ * \returns the CRC-32 of the sections added to this state.
+ */
+uint32_t FAT32_SYM(crc32_final)(const FAT32_SYM(crc32_state)* state)
+{
+    uint32_t crc;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(crc32_final), state);
+
+    crc = state->crc ^ 0xffffffff;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(FAT32_SYM(crc32_final), crc, state);
+
+    return crc;
+}
@@ -0,0 +1,26 @@
+/**
+ * \file crc/crc32_init.c
+ *
+ * \brief Initialize a CRC-32 state.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+/**
+ * \brief Initialize a CRC-32 state.
+ *
+ * \param state         The state to initialize.
+ */
+void FAT32_SYM(crc32_init)(FAT32_SYM(crc32_state)* state)
+{
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(crc32_init), state);
+
+    state->crc = 0xffffffff;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(FAT32_SYM(crc32_init), state);
+}
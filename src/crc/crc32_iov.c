@@ -0,0 +1,42 @@
+/**
+ * \file crc/crc32_iov.c
+ *
+ * \brief Calculate the CRC-32 of a vector of memory sections.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Calculates the CRC-32 of a vector of memory sections, in order.
+ *
+ * \param iov           The vector of memory sections to CRC.
+ * \param iovcnt        The number of memory sections in this vector.
+ *
+ * \returns the CRC-32 of the concatenation of these memory sections.
+ */
+uint32_t FAT32_SYM(crc32_iov)(const struct iovec* iov, size_t iovcnt)
+{
+    uint32_t crc = 0xffffffff;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(crc32_iov), iov, iovcnt);
+
+    /* run each section through the kernel without staging a copy. */
+    for (size_t i = 0; i < iovcnt; ++i)
+    {
+        crc = FAT32_SYM(crc32_kernel)(crc, iov[i].iov_base, iov[i].iov_len);
+    }
+
+    crc ^= 0xffffffff;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_iov), crc, iov, iovcnt);
+
+    return crc;
+}
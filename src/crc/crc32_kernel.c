@@ -0,0 +1,104 @@
+/**
+ * \file crc/crc32_kernel.c
+ *
+ * \brief Select the best CRC-32 kernel for the host CPU.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdatomic.h>
+
+#include "../cpu/cpu_internal.h"
+#include "crc32_internal.h"
+
+#ifndef CBMC
+
+/* forward decls. */
+static uint32_t resolve_kernel(uint32_t crc, const void* data, size_t size);
+
+/* the selected kernel; the first call through here resolves it. */
+static _Atomic(FAT32_SYM(crc32_kernel_fn)) selected_kernel = &resolve_kernel;
+
+/**
+ * \brief Update a raw CRC-32 register using the best kernel for this host.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+uint32_t FAT32_SYM(crc32_kernel)(uint32_t crc, const void* data, size_t size)
+{
+    FAT32_SYM(crc32_kernel_fn) kernel =
+        atomic_load_explicit(&selected_kernel, memory_order_relaxed);
+
+    return kernel(crc, data, size);
+}
+
+/**
+ * \brief Get the best CRC-32 kernel for this host.
+ *
+ * \returns the selected kernel.
+ */
+FAT32_SYM(crc32_kernel_fn) FAT32_SYM(crc32_kernel_select)(void)
+{
+#if defined(__x86_64__)
+    uint32_t features = FAT32_SYM(cpu_features)();
+    const uint32_t wide_features =
+        FAT32_CPU_FEATURE_PCLMUL | FAT32_CPU_FEATURE_AVX512
+      | FAT32_CPU_FEATURE_VPCLMUL;
+
+    if (wide_features == (features & wide_features))
+    {
+        return &FAT32_SYM(crc32_kernel_vpclmul);
+    }
+
+    if (features & FAT32_CPU_FEATURE_PCLMUL)
+    {
+        return &FAT32_SYM(crc32_kernel_pclmul);
+    }
+#endif
+
+    return &FAT32_SYM(crc32_kernel_slice16);
+}
+
+/**
+ * \brief Select the kernel on first use, then run it.
+ *
+ * \note Selection is idempotent, so threads racing through here store the same
+ * kernel.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+static uint32_t resolve_kernel(uint32_t crc, const void* data, size_t size)
+{
+    FAT32_SYM(crc32_kernel_fn) kernel = FAT32_SYM(crc32_kernel_select)();
+
+    atomic_store_explicit(&selected_kernel, kernel, memory_order_relaxed);
+
+    return kernel(crc, data, size);
+}
+
+#else
+
+/**
+ * \brief Under model checking, always use the portable kernel.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+uint32_t FAT32_SYM(crc32_kernel)(uint32_t crc, const void* data, size_t size)
+{
+    return FAT32_SYM(crc32_kernel_slice16)(crc, data, size);
+}
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * \file crc/crc32_kernel_bytewise.c
+ *
+ * \brief Byte-at-a-time CRC-32 kernel.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Update a raw CRC-32 register one byte at a time.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+uint32_t FAT32_SYM(crc32_kernel_bytewise)(
+    uint32_t crc, const void* data, size_t size)
+{
+    const uint8_t* bdata = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i)
+    {
+        int offset = (crc ^ bdata[i]) & 0xFF;
+        crc = FAT32_SYM(crc32_constants)[offset] ^ (crc >> 8);
+    }
+
+    return crc;
+}
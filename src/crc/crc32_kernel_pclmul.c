@@ -0,0 +1,123 @@
+/**
+ * \file crc/crc32_kernel_pclmul.c
+ *
+ * \brief Carry-less multiply folding CRC-32 kernel for x86-64.
+ *
+ * \note This follows Gopal et al., "Fast CRC Computation for Generic
+ * Polynomials Using PCLMULQDQ Instruction" (Intel, 2009), for the bit-reflected
+ * RFC 1952 polynomial.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_pclmul.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+/**
+ * \brief Update a raw CRC-32 register using carry-less multiply folding.
+ *
+ * \note Inputs shorter than 16 bytes are handed to the slicing-by-16 kernel.
+ * Inputs shorter than 64 bytes are folded as a single lane.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+FAT32_CRC32_PCLMUL_TARGET
+uint32_t FAT32_SYM(crc32_kernel_pclmul)(
+    uint32_t crc, const void* data, size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    __m128i x0, x1, x2, x3, x4;
+
+    /* inputs shorter than a lane can't be folded. */
+    if (size < 16)
+    {
+        return FAT32_SYM(crc32_kernel_slice16)(crc, data, size);
+    }
+
+    /* short inputs can't fill the four folding lanes. */
+    if (size < 64)
+    {
+        x1 = _mm_loadu_si128((const __m128i*)p);
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+
+        return FAT32_SYM(crc32_pclmul_finish)(x1, p + 16, size - 16);
+    }
+
+    /* load the first four lanes, adding the CRC register to the first. */
+    x1 = _mm_loadu_si128((const __m128i*)(p + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(p + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(p + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(p + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    p += 64;
+    size -= 64;
+
+    /* fold 64 bytes per iteration across four independent lanes. */
+    x0 = _mm_loadu_si128((const __m128i*)crc32_pclmul_k1k2);
+    while (size >= 64)
+    {
+        x1 = crc32_pclmul_fold(
+                x1, x0, _mm_loadu_si128((const __m128i*)(p + 0x00)));
+        x2 = crc32_pclmul_fold(
+                x2, x0, _mm_loadu_si128((const __m128i*)(p + 0x10)));
+        x3 = crc32_pclmul_fold(
+                x3, x0, _mm_loadu_si128((const __m128i*)(p + 0x20)));
+        x4 = crc32_pclmul_fold(
+                x4, x0, _mm_loadu_si128((const __m128i*)(p + 0x30)));
+        p += 64;
+        size -= 64;
+    }
+
+    /* fold the four lanes into one. */
+    x0 = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+    x1 = crc32_pclmul_fold(x1, x0, x2);
+    x1 = crc32_pclmul_fold(x1, x0, x3);
+    x1 = crc32_pclmul_fold(x1, x0, x4);
+
+    return FAT32_SYM(crc32_pclmul_finish)(x1, p, size);
+}
+
+/**
+ * \brief Fold the remaining whole lanes of an input into a 128-bit accumulator,
+ * reduce it to a raw CRC-32 register, and finish any tail.
+ *
+ * \note A tail shorter than a lane is folded in register, which requires at
+ * least 16 bytes of input to precede it.
+ *
+ * \param acc           The 128-bit folding accumulator.
+ * \param data          The remaining data.
+ * \param size          Size of the remaining data.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+FAT32_CRC32_PCLMUL_TARGET
+uint32_t FAT32_SYM(crc32_pclmul_finish)(
+    __m128i acc, const void* data, size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    __m128i k = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+
+    /* fold any remaining whole lanes. */
+    while (size >= 16)
+    {
+        acc = crc32_pclmul_fold(acc, k, _mm_loadu_si128((const __m128i*)p));
+        p += 16;
+        size -= 16;
+    }
+
+    /* fold a partial lane. */
+    if (size > 0)
+    {
+        acc = crc32_pclmul_fold_partial(acc, p, size);
+    }
+
+    return crc32_pclmul_reduce(acc);
+}
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * \file crc/crc32_kernel_slice16.c
+ *
+ * \brief Slicing-by-16 CRC-32 kernel.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Update a raw CRC-32 register sixteen bytes at a time using the
+ * slicing constants.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+uint32_t FAT32_SYM(crc32_kernel_slice16)(
+    uint32_t crc, const void* data, size_t size)
+{
+    return
+        FAT32_SYM(crc32_slice16)(
+            FAT32_SYM(crc32_slice_constants), crc, data, size);
+}
@@ -0,0 +1,146 @@
+/**
+ * \file crc/crc32_kernel_vpclmul.c
+ *
+ * \brief 512-bit carry-less multiply folding CRC-32 kernel for x86-64.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+#define VPCLMUL_TARGET \
+    __attribute__((target("avx512f,avx512vl,vpclmulqdq,pclmul")))
+
+/*
+ * Folding constants, as in the PCLMUL kernel: K(n) is the bit-reflected
+ * x^n mod P(x), shifted left by one. Each pair folds a 128-bit lane forward by
+ * the given distance.
+ */
+/* K(2048+32), K(2048-32): fold four 512-bit accumulators by 256 bytes. */
+static const uint64_t k_2048[2] = { 0x011542778a, 0x01322d1430 };
+/* K(512+32), K(512-32): fold one 512-bit accumulator by 64 bytes. */
+static const uint64_t k_512[2] = { 0x0154442bd4, 0x01c6e41596 };
+/* K(384+32), K(384-32): fold the lowest lane into the highest lane. */
+static const uint64_t k_384[2] = { 0x003db1ecdc, 0x0174359406 };
+/* K(256+32), K(256-32): fold the second lane into the highest lane. */
+static const uint64_t k_256[2] = { 0x00f1da05aa, 0x015a546366 };
+/* K(128+32), K(128-32): fold the third lane into the highest lane. */
+static const uint64_t k_128[2] = { 0x01751997d0, 0x00ccaa009e };
+
+/**
+ * \brief Fold a 512-bit accumulator forward and add the next block.
+ *
+ * \param acc           The accumulator to fold.
+ * \param k             The folding constants, broadcast to every lane.
+ * \param data          The block to add.
+ *
+ * \returns the folded accumulator.
+ */
+static inline VPCLMUL_TARGET __m512i fold512(
+    __m512i acc, __m512i k, __m512i data)
+{
+    __m512i lo = _mm512_clmulepi64_epi128(acc, k, 0x00);
+    __m512i hi = _mm512_clmulepi64_epi128(acc, k, 0x11);
+
+    /* 0x96 is a three-way exclusive or. */
+    return _mm512_ternarylogic_epi64(lo, hi, data, 0x96);
+}
+
+/**
+ * \brief Fold a 128-bit lane forward and add another lane.
+ *
+ * \param acc           The lane to fold.
+ * \param k             The folding constants.
+ * \param data          The lane to add.
+ *
+ * \returns the folded lane.
+ */
+static inline VPCLMUL_TARGET __m128i fold128(
+    __m128i acc, __m128i k, __m128i data)
+{
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+
+    return _mm_ternarylogic_epi64(lo, hi, data, 0x96);
+}
+
+/**
+ * \brief Update a raw CRC-32 register using 512-bit carry-less multiply
+ * folding.
+ *
+ * \note Four 512-bit accumulators fold 256 bytes per iteration. Inputs below
+ * \ref FAT32_CRC32_VPCLMUL_THRESHOLD are handed to the PCLMUL kernel, which
+ * has lower startup latency.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+VPCLMUL_TARGET
+uint32_t FAT32_SYM(crc32_kernel_vpclmul)(
+    uint32_t crc, const void* data, size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    __m512i z0, z1, z2, z3, k;
+    __m128i x, a0, a1, a2, a3;
+
+    /* smaller inputs do better on the 128-bit kernel. */
+    if (size < FAT32_CRC32_VPCLMUL_THRESHOLD)
+    {
+        return FAT32_SYM(crc32_kernel_pclmul)(crc, data, size);
+    }
+
+    /* load the first four accumulators, adding the CRC register. */
+    z0 = _mm512_loadu_si512((const void*)(p + 0x00));
+    z1 = _mm512_loadu_si512((const void*)(p + 0x40));
+    z2 = _mm512_loadu_si512((const void*)(p + 0x80));
+    z3 = _mm512_loadu_si512((const void*)(p + 0xC0));
+    z0 = _mm512_xor_si512(z0, _mm512_zextsi128_si512(_mm_cvtsi32_si128(crc)));
+    p += 256;
+    size -= 256;
+
+    /* fold 256 bytes per iteration across four independent accumulators. */
+    k = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)k_2048));
+    while (size >= 256)
+    {
+        z0 = fold512(z0, k, _mm512_loadu_si512((const void*)(p + 0x00)));
+        z1 = fold512(z1, k, _mm512_loadu_si512((const void*)(p + 0x40)));
+        z2 = fold512(z2, k, _mm512_loadu_si512((const void*)(p + 0x80)));
+        z3 = fold512(z3, k, _mm512_loadu_si512((const void*)(p + 0xC0)));
+        p += 256;
+        size -= 256;
+    }
+
+    /* fold the four accumulators into one. */
+    k = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)k_512));
+    z0 = fold512(z0, k, z1);
+    z0 = fold512(z0, k, z2);
+    z0 = fold512(z0, k, z3);
+
+    /* fold any remaining 64-byte blocks. */
+    while (size >= 64)
+    {
+        z0 = fold512(z0, k, _mm512_loadu_si512((const void*)p));
+        p += 64;
+        size -= 64;
+    }
+
+    /* fold the four lanes of the accumulator into the highest lane. */
+    a0 = _mm512_extracti32x4_epi32(z0, 0);
+    a1 = _mm512_extracti32x4_epi32(z0, 1);
+    a2 = _mm512_extracti32x4_epi32(z0, 2);
+    a3 = _mm512_extracti32x4_epi32(z0, 3);
+    x = fold128(a0, _mm_loadu_si128((const __m128i*)k_384), a3);
+    x = fold128(a1, _mm_loadu_si128((const __m128i*)k_256), x);
+    x = fold128(a2, _mm_loadu_si128((const __m128i*)k_128), x);
+
+    /* share the 128-bit reduction and tail handling. */
+    return FAT32_SYM(crc32_pclmul_finish)(x, p, size);
+}
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ * \file crc/crc32_multi.c
+ *
+ * \brief Calculate the CRC-32 of each of several independent sections of
+ * memory.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+#include "../cpu/cpu_internal.h"
+#include "crc32_internal.h"
+
+/* forward decls. */
+static FAT32_SYM(crc32_multi4_kernel_fn) multi4_kernel(void);
+
+/**
+ * \brief Calculates the CRC-32 of each of several independent sections of
+ * memory.
+ *
+ * \param bufs          The sections to CRC.
+ * \param sizes         The size of each section.
+ * \param out           The CRC-32 of each section, on return.
+ * \param n             The number of sections.
+ */
+void FAT32_SYM(crc32_multi)(
+    const void* const* bufs, const size_t* sizes, uint32_t* out, size_t n)
+{
+    size_t i = 0;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(crc32_multi), bufs, sizes, out, n);
+
+    FAT32_SYM(crc32_multi4_kernel_fn) kernel = multi4_kernel();
+
+    /* take the sections four at a time. */
+    for (; i + 4 <= n; i += 4)
+    {
+        uint32_t crc[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
+        size_t longest = 0;
+
+        for (int j = 0; j < 4; ++j)
+        {
+            if (sizes[i + j] > longest)
+            {
+                longest = sizes[i + j];
+            }
+        }
+
+        /* short groups are latency bound, so compute them together. */
+        if (longest < FAT32_CRC32_MULTI_THRESHOLD)
+        {
+            kernel(crc, bufs + i, sizes + i);
+        }
+        else
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                crc[j] =
+                    FAT32_SYM(crc32_kernel)(crc[j], bufs[i + j], sizes[i + j]);
+            }
+        }
+
+        for (int j = 0; j < 4; ++j)
+        {
+            out[i + j] = crc[j] ^ 0xffffffff;
+        }
+    }
+
+    /* compute any remaining sections on their own. */
+    for (; i < n; ++i)
+    {
+        out[i] = FAT32_SYM(crc32_kernel)(0xffffffff, bufs[i], sizes[i])
+               ^ 0xffffffff;
+    }
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_multi), bufs, sizes, out, n);
+}
+
+/**
+ * \brief Get the best multi-buffer kernel for this host.
+ *
+ * \note Host features are cached, so this is cheap to call on every batch.
+ *
+ * \returns the multi-buffer kernel.
+ */
+static FAT32_SYM(crc32_multi4_kernel_fn) multi4_kernel(void)
+{
+#if defined(__x86_64__) && !defined(CBMC)
+    if (FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_PCLMUL)
+    {
+        return &FAT32_SYM(crc32_multi4_pclmul);
+    }
+#endif
+
+    return &FAT32_SYM(crc32_multi4_slice16);
+}
@@ -0,0 +1,131 @@
+/**
+ * \file crc/crc32_multi4_pclmul.c
+ *
+ * \brief Carry-less multiply folding CRC-32 over four interleaved streams.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_pclmul.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+/**
+ * \brief Fold the remainder of a buffer into its accumulator.
+ *
+ * \param acc           The accumulator, covering at least 16 bytes.
+ * \param data          The remainder of the buffer.
+ * \param size          Size of the remainder.
+ *
+ * \returns the folded accumulator.
+ */
+static inline FAT32_CRC32_PCLMUL_TARGET __m128i fold_remainder(
+    __m128i acc, const uint8_t* data, size_t size)
+{
+    __m128i k = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+
+    while (size >= 16)
+    {
+        acc = crc32_pclmul_fold(acc, k, _mm_loadu_si128((const __m128i*)data));
+        data += 16;
+        size -= 16;
+    }
+
+    if (size > 0)
+    {
+        acc = crc32_pclmul_fold_partial(acc, data, size);
+    }
+
+    return acc;
+}
+
+/**
+ * \brief Update four raw CRC-32 registers over four independent buffers using
+ * carry-less multiply folding.
+ *
+ * \note Each buffer is folded as a single 128-bit lane. A single lane is bound
+ * by the latency of the carry-less multiply, as is the reduction that follows
+ * it, so the four buffers are folded and reduced together to keep the
+ * multiplier busy. If any buffer is shorter than a lane, each buffer is
+ * finished on its own.
+ *
+ * \param crc           The four raw CRC-32 registers, updated in place.
+ * \param bufs          The four buffers.
+ * \param sizes         The sizes of the four buffers.
+ */
+FAT32_CRC32_PCLMUL_TARGET
+void FAT32_SYM(crc32_multi4_pclmul)(
+    uint32_t crc[4], const void* const bufs[4], const size_t sizes[4])
+{
+    const uint8_t* p0 = (const uint8_t*)bufs[0];
+    const uint8_t* p1 = (const uint8_t*)bufs[1];
+    const uint8_t* p2 = (const uint8_t*)bufs[2];
+    const uint8_t* p3 = (const uint8_t*)bufs[3];
+    __m128i x0, x1, x2, x3, k;
+
+    /* the number of bytes that every buffer has. */
+    size_t common = sizes[0];
+    for (int i = 1; i < 4; ++i)
+    {
+        if (sizes[i] < common)
+        {
+            common = sizes[i];
+        }
+    }
+
+    /* without a whole lane in every buffer, finish each buffer on its own. */
+    if (common < 16)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            crc[i] = FAT32_SYM(crc32_kernel)(crc[i], bufs[i], sizes[i]);
+        }
+
+        return;
+    }
+
+    common &= ~(size_t)15;
+
+    /* load the first lane of each buffer, adding its CRC register. */
+    x0 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)p0),
+            _mm_cvtsi32_si128((int)crc[0]));
+    x1 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)p1),
+            _mm_cvtsi32_si128((int)crc[1]));
+    x2 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)p2),
+            _mm_cvtsi32_si128((int)crc[2]));
+    x3 = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)p3),
+            _mm_cvtsi32_si128((int)crc[3]));
+
+    /* fold the four buffers together. */
+    k = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+    for (size_t offset = 16; offset < common; offset += 16)
+    {
+        x0 = crc32_pclmul_fold(
+                x0, k, _mm_loadu_si128((const __m128i*)(p0 + offset)));
+        x1 = crc32_pclmul_fold(
+                x1, k, _mm_loadu_si128((const __m128i*)(p1 + offset)));
+        x2 = crc32_pclmul_fold(
+                x2, k, _mm_loadu_si128((const __m128i*)(p2 + offset)));
+        x3 = crc32_pclmul_fold(
+                x3, k, _mm_loadu_si128((const __m128i*)(p3 + offset)));
+    }
+
+    /* fold each remainder. */
+    x0 = fold_remainder(x0, p0 + common, sizes[0] - common);
+    x1 = fold_remainder(x1, p1 + common, sizes[1] - common);
+    x2 = fold_remainder(x2, p2 + common, sizes[2] - common);
+    x3 = fold_remainder(x3, p3 + common, sizes[3] - common);
+
+    /* reduce the four accumulators together. */
+    crc[0] = crc32_pclmul_reduce(x0);
+    crc[1] = crc32_pclmul_reduce(x1);
+    crc[2] = crc32_pclmul_reduce(x2);
+    crc[3] = crc32_pclmul_reduce(x3);
+}
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * \file crc/crc32_multi4_slice16.c
+ *
+ * \brief Slicing-by-16 CRC-32 over four interleaved streams.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+#define T FAT32_SYM(crc32_slice_constants)
+
+/**
+ * \brief Fold sixteen bytes into a raw CRC-32 register.
+ *
+ * \param crc           The raw CRC-32 register.
+ * \param p             The sixteen bytes to fold.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+static inline uint32_t step16(uint32_t crc, const uint8_t* p)
+{
+    uint32_t w =
+        crc
+      ^ (((uint32_t)p[0])      ) ^ (((uint32_t)p[1]) <<  8)
+      ^ (((uint32_t)p[2]) << 16) ^ (((uint32_t)p[3]) << 24);
+
+    return
+        T[15][ w        & 0xFF] ^ T[14][(w >>  8) & 0xFF]
+      ^ T[13][(w >> 16) & 0xFF] ^ T[12][(w >> 24)       ]
+      ^ T[11][p[ 4]] ^ T[10][p[ 5]] ^ T[ 9][p[ 6]] ^ T[ 8][p[ 7]]
+      ^ T[ 7][p[ 8]] ^ T[ 6][p[ 9]] ^ T[ 5][p[10]] ^ T[ 4][p[11]]
+      ^ T[ 3][p[12]] ^ T[ 2][p[13]] ^ T[ 1][p[14]] ^ T[ 0][p[15]];
+}
+
+/**
+ * \brief Update four raw CRC-32 registers over four independent buffers.
+ *
+ * \note The four dependency chains are advanced together for as many
+ * sixteen-byte blocks as every buffer has. Each buffer's remainder is then
+ * finished on its own.
+ *
+ * \param crc           The four raw CRC-32 registers, updated in place.
+ * \param bufs          The four buffers.
+ * \param sizes         The sizes of the four buffers.
+ */
+void FAT32_SYM(crc32_multi4_slice16)(
+    uint32_t crc[4], const void* const bufs[4], const size_t sizes[4])
+{
+    const uint8_t* p0 = (const uint8_t*)bufs[0];
+    const uint8_t* p1 = (const uint8_t*)bufs[1];
+    const uint8_t* p2 = (const uint8_t*)bufs[2];
+    const uint8_t* p3 = (const uint8_t*)bufs[3];
+    uint32_t c0 = crc[0], c1 = crc[1], c2 = crc[2], c3 = crc[3];
+
+    /* the number of bytes that every buffer has. */
+    size_t common = sizes[0];
+    for (int i = 1; i < 4; ++i)
+    {
+        if (sizes[i] < common)
+        {
+            common = sizes[i];
+        }
+    }
+
+    common &= ~(size_t)15;
+
+    /* advance the four chains together. */
+    for (size_t offset = 0; offset < common; offset += 16)
+    {
+        c0 = step16(c0, p0 + offset);
+        c1 = step16(c1, p1 + offset);
+        c2 = step16(c2, p2 + offset);
+        c3 = step16(c3, p3 + offset);
+    }
+
+    /* finish each remainder on its own. */
+    crc[0] = FAT32_SYM(crc32_kernel)(c0, p0 + common, sizes[0] - common);
+    crc[1] = FAT32_SYM(crc32_kernel)(c1, p1 + common, sizes[1] - common);
+    crc[2] = FAT32_SYM(crc32_kernel)(c2, p2 + common, sizes[2] - common);
+    crc[3] = FAT32_SYM(crc32_kernel)(c3, p3 + common, sizes[3] - common);
+}
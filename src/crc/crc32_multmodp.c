@@ -0,0 +1,51 @@
+/**
+ * \file crc/crc32_multmodp.c
+ *
+ * \brief Multiply two polynomials modulo the CRC-32 polynomial.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+#define CRC32_POLYNOMIAL 0xedb88320
+
+/**
+ * \brief Multiply two polynomials modulo the CRC-32 polynomial.
+ *
+ * \param a             The first polynomial.
+ * \param b             The second polynomial.
+ *
+ * \returns a(x) * b(x) mod P(x).
+ */
+uint32_t FAT32_SYM(crc32_multmodp)(uint32_t a, uint32_t b)
+{
+    uint32_t m = (uint32_t)1 << 31;
+    uint32_t p = 0;
+
+    /* multiplying by zero yields zero. */
+    if (0 == a)
+    {
+        return 0;
+    }
+
+    for (;;)
+    {
+        /* add b(x) * x^k for each term x^k in a(x). */
+        if (a & m)
+        {
+            p ^= b;
+            if (0 == (a & (m - 1)))
+            {
+                break;
+            }
+        }
+
+        /* advance b(x) to the next power of x. */
+        m >>= 1;
+        b = (b & 1) ? (CRC32_POLYNOMIAL ^ (b >> 1)) : (b >> 1);
+    }
+
+    return p;
+}
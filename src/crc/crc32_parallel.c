@@ -0,0 +1,170 @@
+/**
+ * \file crc/crc32_parallel.c
+ *
+ * \brief Calculate the CRC-32 of a section of memory using several threads.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "crc32_internal.h"
+
+/* the smallest chunk worth the cost of starting a thread. */
+#define CRC32_PARALLEL_MIN_CHUNK (1024UL * 1024UL)
+
+/* the largest number of threads used for a single call. */
+#define CRC32_PARALLEL_MAX_THREADS 64
+
+/**
+ * \brief A chunk of work for a single thread.
+ */
+typedef struct crc32_chunk crc32_chunk;
+
+struct crc32_chunk
+{
+    const uint8_t* data;
+    size_t size;
+    uint32_t crc;
+    pthread_t thread;
+    bool started;
+};
+
+/* forward decls. */
+static void* chunk_worker(void* context);
+static unsigned int thread_count(size_t size, unsigned int nthreads);
+
+/**
+ * \brief Calculates the CRC-32 of a given section of memory using several
+ * threads.
+ *
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ * \param nthreads      The maximum number of threads to use, including the
+ *                      calling thread, or 0 to use one per online CPU.
+ *
+ * \returns the CRC-32 of this section of memory.
+ */
+uint32_t FAT32_SYM(crc32_parallel)(
+    const void* data, size_t size, unsigned int nthreads)
+{
+    crc32_chunk chunks[CRC32_PARALLEL_MAX_THREADS];
+    uint32_t crc;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(crc32_parallel), data, size, nthreads);
+
+    /* small sections are computed on the calling thread. */
+    unsigned int count = thread_count(size, nthreads);
+    if (count < 2)
+    {
+        crc = FAT32_SYM(crc32)(data, size);
+        goto done;
+    }
+
+    /* split the section into contiguous chunks; the last takes the rest. */
+    const uint8_t* bdata = (const uint8_t*)data;
+    size_t chunk_size = size / count;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        chunks[i].data = bdata + i * chunk_size;
+        chunks[i].size = (i + 1 == count) ? size - i * chunk_size : chunk_size;
+        chunks[i].started = false;
+    }
+
+    /* start a worker for every chunk but the first. */
+    for (unsigned int i = 1; i < count; ++i)
+    {
+        chunks[i].started =
+            0 == pthread_create(
+                    &chunks[i].thread, NULL, &chunk_worker, &chunks[i]);
+    }
+
+    /* the calling thread takes the first chunk, and any that didn't start. */
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        if (!chunks[i].started)
+        {
+            chunk_worker(&chunks[i]);
+        }
+    }
+
+    /* join the workers and merge the chunk CRCs in order. */
+    crc = chunks[0].crc;
+    for (unsigned int i = 1; i < count; ++i)
+    {
+        if (chunks[i].started)
+        {
+            pthread_join(chunks[i].thread, NULL);
+        }
+
+        crc = FAT32_SYM(crc32_combine)(crc, chunks[i].crc, chunks[i].size);
+    }
+
+    goto done;
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_parallel), crc, data, size, nthreads);
+
+    return crc;
+}
+
+/**
+ * \brief Compute the CRC-32 of a single chunk.
+ *
+ * \param context       The chunk to compute.
+ *
+ * \returns NULL.
+ */
+static void* chunk_worker(void* context)
+{
+    crc32_chunk* chunk = (crc32_chunk*)context;
+
+    chunk->crc = FAT32_SYM(crc32)(chunk->data, chunk->size);
+
+    return NULL;
+}
+
+/**
+ * \brief Decide how many threads to use for a section.
+ *
+ * \param size          Size of the section.
+ * \param nthreads      The requested maximum, or 0 for one per online CPU.
+ *
+ * \returns the number of threads to use, including the calling thread.
+ */
+static unsigned int thread_count(size_t size, unsigned int nthreads)
+{
+    /* never use more threads than we have chunks of a useful size. */
+    size_t max_chunks = size / CRC32_PARALLEL_MIN_CHUNK;
+    if (max_chunks < 2)
+    {
+        return 1;
+    }
+
+    /* default to one thread per online CPU. */
+    if (0 == nthreads)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (cpus > 0) ? (unsigned int)cpus : 1;
+    }
+
+    if (nthreads > max_chunks)
+    {
+        nthreads = (unsigned int)max_chunks;
+    }
+
+    if (nthreads > CRC32_PARALLEL_MAX_THREADS)
+    {
+        nthreads = CRC32_PARALLEL_MAX_THREADS;
+    }
+
+    return nthreads;
+}
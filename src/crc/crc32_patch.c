@@ -0,0 +1,81 @@
+/**
+ * \file crc/crc32_patch.c
+ *
+ * \brief Update the CRC-32 of a section of memory after a sub-range changes.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+#include "crc32_internal.h"
+
+/* the difference between the old and new bytes is built in blocks this size. */
+#define CRC32_PATCH_BLOCK_SIZE 256
+
+/**
+ * \brief Update the CRC-32 of a section of memory after a sub-range of it
+ * changes.
+ *
+ * \note The new section is the old section plus a difference that is zero
+ * outside of the sub-range. CRC-32 is linear, so the new CRC-32 is the old
+ * CRC-32 plus the raw CRC-32 register of that difference, starting from zero.
+ * Leading zero bytes don't change a zero register, and trailing zero bytes are
+ * applied with a single zero operator.
+ *
+ * \param old_crc       The CRC-32 of the section before the change.
+ * \param total_len     The size of the section in bytes.
+ * \param offset        The offset of the changed sub-range in the section.
+ * \param old_bytes     The bytes of the sub-range before the change.
+ * \param new_bytes     The bytes of the sub-range after the change.
+ * \param n             The size of the sub-range in bytes.
+ *
+ * \returns the CRC-32 of the section after the change.
+ */
+uint32_t FAT32_SYM(crc32_patch)(
+    uint32_t old_crc, uint64_t total_len, uint64_t offset,
+    const void* old_bytes, const void* new_bytes, size_t n)
+{
+    uint8_t delta[CRC32_PATCH_BLOCK_SIZE];
+    const uint8_t* old_p = (const uint8_t*)old_bytes;
+    const uint8_t* new_p = (const uint8_t*)new_bytes;
+    uint32_t crc = 0;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(crc32_patch), old_crc, total_len, offset, old_bytes,
+        new_bytes, n);
+
+    /* run a zero register over the difference, one block at a time. */
+    for (size_t pos = 0; pos < n; )
+    {
+        size_t block = n - pos;
+        if (block > CRC32_PATCH_BLOCK_SIZE)
+        {
+            block = CRC32_PATCH_BLOCK_SIZE;
+        }
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            delta[i] = old_p[pos + i] ^ new_p[pos + i];
+        }
+
+        crc = FAT32_SYM(crc32_kernel)(crc, delta, block);
+        pos += block;
+    }
+
+    /* run the difference through the rest of the section. */
+    crc =
+        FAT32_SYM(crc32_multmodp)(
+            FAT32_SYM(crc32_x8nmodp)(total_len - offset - n), crc);
+
+    crc ^= old_crc;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(crc32_patch), crc, old_crc, total_len, offset, old_bytes,
+        new_bytes, n);
+
+    return crc;
+}
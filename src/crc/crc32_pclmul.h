@@ -0,0 +1,151 @@
+/**
+ * \file crc/crc32_pclmul.h
+ *
+ * \brief Carry-less multiply folding steps shared by the PCLMUL kernels.
+ *
+ * \note This follows Gopal et al., "Fast CRC Computation for Generic
+ * Polynomials Using PCLMULQDQ Instruction" (Intel, 2009), for the bit-reflected
+ * RFC 1952 polynomial. Each step is inlined, so that kernels working on several
+ * independent accumulators can interleave them.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include "crc32_internal.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+#include <immintrin.h>
+
+#define FAT32_CRC32_PCLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+
+/*
+ * Folding constants. K(n) is the bit-reflected x^n mod P(x), shifted left by
+ * one to account for the reflected product.
+ */
+/* K(4*128+32), K(4*128-32): fold four lanes forward by 512 bits. */
+static const uint64_t crc32_pclmul_k1k2[2] = { 0x0154442bd4, 0x01c6e41596 };
+/* K(128+32), K(128-32): fold one lane forward by 128 bits. */
+static const uint64_t crc32_pclmul_k3k4[2] = { 0x01751997d0, 0x00ccaa009e };
+/* K(64): fold 64 bits down to 32 bits. */
+static const uint64_t crc32_pclmul_k5k0[2] = { 0x0163cd6124, 0x0000000000 };
+/* Reflected P(x) and the Barrett constant floor(x^64 / P(x)). */
+static const uint64_t crc32_pclmul_poly[2] = { 0x01db710641, 0x01f7011641 };
+
+/*
+ * Byte shift masks for pshufb. The 16 bytes at offset r shift a lane up by
+ * 16 - r bytes, and the 16 bytes at offset 16 + r shift a lane down by r bytes.
+ */
+static const uint8_t crc32_pclmul_shift_table[48] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 };
+
+/* The 16 bytes at offset r select the top r bytes of a lane. */
+static const uint8_t crc32_pclmul_mask_table[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+/**
+ * \brief Fold an accumulator forward and add the next block.
+ *
+ * \param acc           The accumulator to fold.
+ * \param k             The folding constants for the fold distance.
+ * \param data          The block to add.
+ *
+ * \returns the folded accumulator.
+ */
+static inline FAT32_CRC32_PCLMUL_TARGET __m128i crc32_pclmul_fold(
+    __m128i acc, __m128i k, __m128i data)
+{
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), data);
+}
+
+/**
+ * \brief Fold a tail shorter than a lane into an accumulator.
+ *
+ * \note The accumulator is treated as the 16 message bytes before the tail, and
+ * those 16 + r bytes are re-split into r leading bytes, zero-extended to a
+ * lane, and a whole lane made of the last 16 - r accumulator bytes and the
+ * tail. The whole lane is read with an overlapping load that ends at the end
+ * of the input, so at least 16 bytes of input must precede the tail.
+ *
+ * \param acc           The accumulator to fold.
+ * \param data          The tail.
+ * \param size          Size of the tail, from 1 to 15 bytes.
+ *
+ * \returns the folded accumulator.
+ */
+static inline FAT32_CRC32_PCLMUL_TARGET __m128i crc32_pclmul_fold_partial(
+    __m128i acc, const uint8_t* data, size_t size)
+{
+    __m128i k = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+    __m128i last = _mm_loadu_si128((const __m128i*)(data + size - 16));
+    __m128i lead =
+        _mm_shuffle_epi8(
+            acc,
+            _mm_loadu_si128(
+                (const __m128i*)(crc32_pclmul_shift_table + size)));
+    __m128i lane =
+        _mm_or_si128(
+            _mm_shuffle_epi8(
+                acc,
+                _mm_loadu_si128(
+                    (const __m128i*)(crc32_pclmul_shift_table + 16 + size))),
+            _mm_and_si128(
+                last,
+                _mm_loadu_si128(
+                    (const __m128i*)(crc32_pclmul_mask_table + size))));
+
+    return crc32_pclmul_fold(lead, k, lane);
+}
+
+/**
+ * \brief Reduce a 128-bit accumulator to a raw CRC-32 register.
+ *
+ * \param acc           The accumulator to reduce.
+ *
+ * \returns the raw CRC-32 register.
+ */
+static inline FAT32_CRC32_PCLMUL_TARGET uint32_t crc32_pclmul_reduce(
+    __m128i acc)
+{
+    __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x0, x1, x2;
+
+    /* fold 128 bits down to 64 bits. */
+    x0 = _mm_loadu_si128((const __m128i*)crc32_pclmul_k3k4);
+    x2 = _mm_clmulepi64_si128(acc, x0, 0x10);
+    x1 = _mm_srli_si128(acc, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* fold 64 bits down to 32 bits. */
+    x0 = _mm_loadl_epi64((const __m128i*)crc32_pclmul_k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduce to the 32-bit register. */
+    x0 = _mm_loadu_si128((const __m128i*)crc32_pclmul_poly);
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * \file crc/crc32_slice16.c
+ *
+ * \brief Slicing-by-16 update for any reflected CRC-32 polynomial.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Update a raw CRC-32 register sixteen bytes at a time using the given
+ * slicing constants.
+ *
+ * \note Each block of sixteen bytes is folded with sixteen independent table
+ * lookups instead of a serial chain of sixteen lookups. Bytes are read
+ * individually so that this kernel is independent of host byte order and
+ * alignment; compilers fuse these into word loads where possible.
+ *
+ * \param T             The slicing constants for the polynomial.
+ * \param crc           The raw CRC-32 register.
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the updated raw CRC-32 register.
+ */
+uint32_t FAT32_SYM(crc32_slice16)(
+    const uint32_t T[16][256], uint32_t crc, const void* data, size_t size)
+{
+    const uint8_t* p = (const uint8_t*)data;
+
+    /* fold sixteen bytes at a time. */
+    while (size >= 16)
+    {
+        uint32_t w =
+            crc
+          ^ (((uint32_t)p[0])      ) ^ (((uint32_t)p[1]) <<  8)
+          ^ (((uint32_t)p[2]) << 16) ^ (((uint32_t)p[3]) << 24);
+
+        crc =
+            T[15][ w        & 0xFF] ^ T[14][(w >>  8) & 0xFF]
+          ^ T[13][(w >> 16) & 0xFF] ^ T[12][(w >> 24)       ]
+          ^ T[11][p[ 4]] ^ T[10][p[ 5]] ^ T[ 9][p[ 6]] ^ T[ 8][p[ 7]]
+          ^ T[ 7][p[ 8]] ^ T[ 6][p[ 9]] ^ T[ 5][p[10]] ^ T[ 4][p[11]]
+          ^ T[ 3][p[12]] ^ T[ 2][p[13]] ^ T[ 1][p[14]] ^ T[ 0][p[15]];
+
+        p += 16;
+        size -= 16;
+    }
+
+    /* fold a remaining block of eight bytes using the first eight tables. */
+    if (size >= 8)
+    {
+        uint32_t w =
+            crc
+          ^ (((uint32_t)p[0])      ) ^ (((uint32_t)p[1]) <<  8)
+          ^ (((uint32_t)p[2]) << 16) ^ (((uint32_t)p[3]) << 24);
+
+        crc =
+            T[ 7][ w        & 0xFF] ^ T[ 6][(w >>  8) & 0xFF]
+          ^ T[ 5][(w >> 16) & 0xFF] ^ T[ 4][(w >> 24)       ]
+          ^ T[ 3][p[ 4]] ^ T[ 2][p[ 5]] ^ T[ 1][p[ 6]] ^ T[ 0][p[ 7]];
+
+        p += 8;
+        size -= 8;
+    }
+
+    /* finish the tail one byte at a time. */
+    while (size--)
+    {
+        crc = T[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file crc/crc32_x8nmodp.c
+ *
+ * \brief Get the operator that runs a CRC-32 register through zero bytes.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Get the operator that runs a CRC-32 register through zero bytes.
+ *
+ * \note This multiplies together the precomputed x^(2^k) operators for each set
+ * bit of 8 * len, so it costs one multiplication per bit of len.
+ *
+ * \param len           The number of zero bytes.
+ *
+ * \returns x^(8 * len) mod P(x).
+ */
+uint32_t FAT32_SYM(crc32_x8nmodp)(uint64_t len)
+{
+    /* x^0. */
+    uint32_t p = (uint32_t)1 << 31;
+
+    /* start at x^(2^3), since each byte is eight bits. */
+    for (unsigned int k = 3; 0 != len; len >>= 1, ++k)
+    {
+        if (len & 1)
+        {
+            p = FAT32_SYM(crc32_multmodp)(
+                    FAT32_SYM(crc32_x2n_constants)[k & 31], p);
+        }
+    }
+
+    return p;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file crc/crc32c.c
+ *
+ * \brief CRC-32C algorithm, using the Castagnoli polynomial from RFC 3720.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+
+#include "crc32_internal.h"
+
+/**
+ * \brief Calculates the CRC-32C of a given section of memory.
+ *
+ * \param data          Data array to CRC.
+ * \param size          Size of this array.
+ *
+ * \returns the CRC-32C of this section of memory.
+ */
+uint32_t FAT32_SYM(crc32c)(const void* data, size_t size)
+{
+    uint32_t crc = 0xffffffff;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(crc32c), data, size);
+
+    crc = FAT32_SYM(crc32c_kernel)(crc, data, size);
+
+    crc ^= 0xffffffff;
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(FAT32_SYM(crc32c), crc, data, size);
+
+    return crc;
+}
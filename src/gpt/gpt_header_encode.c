@@ -0,0 +1,91 @@
+/**
+ * \file gpt/gpt_header_encode.c
+ *
+ * \brief Serialize a GPT header.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+FAT32_IMPORT_gpt;
+
+/* forward decls. */
+static void store_le16(uint8_t* p, uint16_t value);
+static void store_le32(uint8_t* p, uint32_t value);
+static void store_le64(uint8_t* p, uint64_t value);
+
+/**
+ * \brief Serialize the first FAT32_GPT_HEADER_SIZE bytes of a GPT header,
+ * including its stored header CRC.
+ *
+ * \param out               The destination, which must hold a whole header.
+ * \param header            The header to serialize.
+ */
+void FAT32_SYM(gpt_header_encode)(
+    uint8_t* out, const FAT32_SYM(gpt_header)* header)
+{
+    memcpy(out, header->signature, sizeof(header->signature));
+    store_le32(out + 8, header->revision);
+    store_le32(out + 12, header->header_size);
+    store_le32(out + FAT32_GPT_HEADER_CRC32_OFFSET, header->header_crc32);
+    memcpy(out + 20, header->reserved, sizeof(header->reserved));
+    store_le64(out + 24, header->my_lba);
+    store_le64(out + 32, header->alternative_lba);
+    store_le64(out + 40, header->first_usable_lba);
+    store_le64(out + 48, header->last_usable_lba);
+
+    /* the disk guid uses the mixed-endian guid encoding. */
+    store_le32(out + 56, header->disk_guid.data1);
+    store_le16(out + 60, header->disk_guid.data2);
+    store_le16(out + 62, header->disk_guid.data3);
+    memcpy(out + 64, header->disk_guid.data4, sizeof(header->disk_guid.data4));
+
+    store_le64(out + 72, header->partition_entry_lba);
+    store_le32(out + 80, header->number_of_partition_entries);
+    store_le32(out + 84, header->size_of_partition_entry);
+    store_le32(out + 88, header->partition_entry_array_crc32);
+}
+
+/**
+ * \brief Store a little-endian 16-bit word.
+ *
+ * \param p                 The two bytes to store.
+ * \param value             The word.
+ */
+static void store_le16(uint8_t* p, uint16_t value)
+{
+    p[0] = (value     ) & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+/**
+ * \brief Store a little-endian 32-bit word.
+ *
+ * \param p                 The four bytes to store.
+ * \param value             The word.
+ */
+static void store_le32(uint8_t* p, uint32_t value)
+{
+    p[0] = (value      ) & 0xFF;
+    p[1] = (value >>  8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = (value >> 24) & 0xFF;
+}
+
+/**
+ * \brief Store a little-endian 64-bit word.
+ *
+ * \param p                 The eight bytes to store.
+ * \param value             The word.
+ */
+static void store_le64(uint8_t* p, uint64_t value)
+{
+    store_le32(p, (uint32_t)value);
+    store_le32(p + 4, (uint32_t)(value >> 32));
+}
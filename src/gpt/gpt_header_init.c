@@ -0,0 +1,95 @@
+/**
+ * \file gpt/gpt_header_init.c
+ *
+ * \brief Initialize a primary GPT header.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+FAT32_IMPORT_gpt;
+
+/**
+ * \brief Initialize a GPT header with the given disk GUID, first usable lba,
+ * last usable lba, and alternative lba.
+ *
+ * \param header            The record to initialize.
+ * \param disk_guid         The disk GUID.
+ * \param first_lba         The first usable lba.
+ * \param last_lba          The last usable lba.
+ * \param alt_lba           The alternative lba.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_header_init)(
+    FAT32_SYM(gpt_header)* header, const FAT32_SYM(guid)* disk_guid,
+    uint64_t first_lba, uint64_t last_lba, uint64_t alt_lba)
+{
+    int retval;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_header_init), header, disk_guid, first_lba, last_lba,
+        alt_lba);
+
+    /* the primary partition entry array must end before the first usable
+     * lba. */
+    if (
+        first_lba
+            <= FAT32_GPT_HEADER_PRIMARY_LBA
+                + FAT32_GPT_HEADER_PARTITION_ENTRY_ARRAY_LBAS)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* the backup partition entry array must fit before the backup header. */
+    if (alt_lba - last_lba <= FAT32_GPT_HEADER_PARTITION_ENTRY_ARRAY_LBAS)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* clear the record. */
+    memset(header, 0, sizeof(*header));
+
+    memcpy(
+        header->signature, FAT32_GPT_HEADER_SIGNATURE,
+        FAT32_GPT_HEADER_SIGNATURE_SIZE);
+    header->revision = FAT32_GPT_HEADER_REVISION;
+    header->header_size = FAT32_GPT_HEADER_SIZE;
+    header->my_lba = FAT32_GPT_HEADER_PRIMARY_LBA;
+    header->alternative_lba = alt_lba;
+    header->first_usable_lba = first_lba;
+    header->last_usable_lba = last_lba;
+    memcpy(&header->disk_guid, disk_guid, sizeof(header->disk_guid));
+    header->partition_entry_lba = FAT32_GPT_HEADER_PRIMARY_LBA + 1;
+    header->number_of_partition_entries =
+        FAT32_GPT_HEADER_PARTITION_ENTRY_COUNT;
+    header->size_of_partition_entry = FAT32_GPT_HEADER_PARTITION_ENTRY_SIZE;
+    header->partition_entry_array_crc32 =
+        FAT32_GPT_HEADER_EMPTY_PARTITION_ENTRY_ARRAY_CRC32;
+
+    /* compute the header CRC once, so that writes just copy it. */
+    gpt_header_update_crc32(header);
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_header_init), retval, header, disk_guid, first_lba,
+        last_lba, alt_lba);
+
+    return retval;
+}
@@ -0,0 +1,66 @@
+/**
+ * \file gpt/gpt_header_init_span.c
+ *
+ * \brief Initialize a primary GPT header spanning a disk.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+
+#include "gpt_internal.h"
+
+FAT32_IMPORT_gpt;
+
+/* A header and its partition entry array. */
+#define HEADER_AND_ARRAY_LBAS \
+    (1 + FAT32_GPT_HEADER_PARTITION_ENTRY_ARRAY_LBAS)
+
+/**
+ * \brief Initialize a GPT header with sane settings for a disk with the given
+ * disk GUID, start lba (after protective MBR), and end lba.
+ *
+ * \param header            The record to initialize.
+ * \param disk_guid         The disk GUID.
+ * \param start_lba         The start lba for this disk.
+ * \param end_lba           The end lba for this disk.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_header_init_span)(
+    FAT32_SYM(gpt_header)* header, const FAT32_SYM(guid)* disk_guid,
+    uint64_t start_lba, uint64_t end_lba)
+{
+    int retval;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_header_init_span), header, disk_guid, start_lba,
+        end_lba);
+
+    /* the last usable lba must be above the first, so at least two lbas lie
+     * between the primary and backup structures. */
+    if (end_lba - start_lba <= 2 * HEADER_AND_ARRAY_LBAS)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    retval =
+        gpt_header_init(
+            header, disk_guid, start_lba + HEADER_AND_ARRAY_LBAS,
+            end_lba - HEADER_AND_ARRAY_LBAS, end_lba);
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_header_init_span), retval, header, disk_guid, start_lba,
+        end_lba);
+
+    return retval;
+}
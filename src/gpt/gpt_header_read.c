@@ -0,0 +1,179 @@
+/**
+ * \file gpt/gpt_header_read.c
+ *
+ * \brief Read a GPT header from memory.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+FAT32_IMPORT_crc;
+
+/* forward decls. */
+static uint16_t load_le16(const uint8_t* p);
+static uint32_t load_le32(const uint8_t* p);
+static uint64_t load_le64(const uint8_t* p);
+
+/* The CRC field is read as zero when checking the CRC. */
+static const uint8_t zero_crc32[4];
+
+/**
+ * \brief Read a GPT header from a given location in RAM.
+ *
+ * \param header            The header to populate with RAM data.
+ * \param ptr               The pointer from which this data is read.
+ * \param size              The size of this data.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_header_read)(
+    FAT32_SYM(gpt_header)* header, const void* ptr, size_t size)
+{
+    int retval;
+    const uint8_t* bptr = (const uint8_t*)ptr;
+    crc32_state state;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_header_read), header, ptr, size);
+
+    /* make sure this memory region is large enough for a header. */
+    if (size < FAT32_GPT_HEADER_SIZE)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* reject anything that isn't a GPT header before doing any other work. */
+    if (
+        0 != memcmp(
+                bptr, FAT32_GPT_HEADER_SIGNATURE,
+                FAT32_GPT_HEADER_SIGNATURE_SIZE))
+    {
+        retval = FAT32_ERROR_GPT_HEADER_BAD_SIGNATURE;
+        goto done;
+    }
+
+    /* the CRC covers header_size bytes, which must be in this region. */
+    uint32_t header_size = load_le32(bptr + 12);
+    if (header_size < FAT32_GPT_HEADER_SIZE || header_size > size)
+    {
+        retval = FAT32_ERROR_GPT_BAD_RECORD;
+        goto done;
+    }
+
+    /* check the CRC of the raw header, with its CRC field read as zero. */
+    crc32_init(&state);
+    crc32_update(&state, bptr, FAT32_GPT_HEADER_CRC32_OFFSET);
+    crc32_update(&state, zero_crc32, sizeof(zero_crc32));
+    crc32_update(
+        &state, bptr + FAT32_GPT_HEADER_CRC32_OFFSET + sizeof(zero_crc32),
+        header_size - FAT32_GPT_HEADER_CRC32_OFFSET - sizeof(zero_crc32));
+
+    uint32_t header_crc32 = load_le32(bptr + FAT32_GPT_HEADER_CRC32_OFFSET);
+    if (crc32_final(&state) != header_crc32)
+    {
+        retval = FAT32_ERROR_GPT_HEADER_BAD_CRC;
+        goto done;
+    }
+
+    /* decode the header. */
+    memcpy(header->signature, bptr, sizeof(header->signature));
+    header->revision = load_le32(bptr + 8);
+    header->header_size = header_size;
+    header->header_crc32 = header_crc32;
+    memcpy(header->reserved, bptr + 20, sizeof(header->reserved));
+    header->my_lba = load_le64(bptr + 24);
+    header->alternative_lba = load_le64(bptr + 32);
+    header->first_usable_lba = load_le64(bptr + 40);
+    header->last_usable_lba = load_le64(bptr + 48);
+    header->disk_guid.data1 = load_le32(bptr + 56);
+    header->disk_guid.data2 = load_le16(bptr + 60);
+    header->disk_guid.data3 = load_le16(bptr + 62);
+    memcpy(
+        header->disk_guid.data4, bptr + 64, sizeof(header->disk_guid.data4));
+    header->partition_entry_lba = load_le64(bptr + 72);
+    header->number_of_partition_entries = load_le32(bptr + 80);
+    header->size_of_partition_entry = load_le32(bptr + 84);
+    header->partition_entry_array_crc32 = load_le32(bptr + 88);
+
+    /* neither header can be in the protective MBR. */
+    if (0 == header->my_lba || 0 == header->alternative_lba)
+    {
+        retval = FAT32_ERROR_GPT_BAD_RECORD;
+        goto done;
+    }
+
+    /* the usable lbas must be a range. */
+    if (header->first_usable_lba > header->last_usable_lba)
+    {
+        retval = FAT32_ERROR_GPT_BAD_RECORD;
+        goto done;
+    }
+
+    /* entries are 128 << n bytes. */
+    uint32_t entry_size = header->size_of_partition_entry;
+    if (entry_size < 128 || 0 != (entry_size & (entry_size - 1)))
+    {
+        retval = FAT32_ERROR_GPT_BAD_RECORD;
+        goto done;
+    }
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_header_read), retval, header, ptr, size);
+
+    return retval;
+}
+
+/**
+ * \brief Load a little-endian 16-bit word.
+ *
+ * \param p                 The two bytes to load.
+ *
+ * \returns the word.
+ */
+static uint16_t load_le16(const uint8_t* p)
+{
+    return (uint16_t)(((uint16_t)p[0]) | ((uint16_t)p[1] << 8));
+}
+
+/**
+ * \brief Load a little-endian 32-bit word.
+ *
+ * \param p                 The four bytes to load.
+ *
+ * \returns the word.
+ */
+static uint32_t load_le32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0])       | ((uint32_t)p[1] <<  8)
+      | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * \brief Load a little-endian 64-bit word.
+ *
+ * \param p                 The eight bytes to load.
+ *
+ * \returns the word.
+ */
+static uint64_t load_le64(const uint8_t* p)
+{
+    return ((uint64_t)load_le32(p + 4) << 32) | load_le32(p);
+}
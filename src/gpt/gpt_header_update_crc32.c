@@ -0,0 +1,56 @@
+/**
+ * \file gpt/gpt_header_update_crc32.c
+ *
+ * \brief Compute and store the CRC of a GPT header.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/gpt.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+FAT32_IMPORT_crc;
+
+/* Zeros for the bytes of a larger header past the fields we keep. */
+static const uint8_t zeros[64];
+
+/**
+ * \brief Compute the CRC of a GPT header and store it in its header_crc32.
+ *
+ * \param header            The header to update.
+ */
+void FAT32_SYM(gpt_header_update_crc32)(FAT32_SYM(gpt_header)* header)
+{
+    uint8_t buffer[FAT32_GPT_HEADER_SIZE];
+    crc32_state state;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_header_update_crc32), header);
+
+    /* the CRC covers the header with its own CRC field cleared. */
+    FAT32_SYM(gpt_header_encode)(buffer, header);
+    memset(buffer + FAT32_GPT_HEADER_CRC32_OFFSET, 0, sizeof(uint32_t));
+
+    crc32_init(&state);
+    crc32_update(&state, buffer, sizeof(buffer));
+
+    /* gpt_header_write clears the rest of a larger header. */
+    for (
+        size_t left = header->header_size - FAT32_GPT_HEADER_SIZE; left > 0;)
+    {
+        size_t count = left < sizeof(zeros) ? left : sizeof(zeros);
+        crc32_update(&state, zeros, count);
+        left -= count;
+    }
+
+    header->header_crc32 = crc32_final(&state);
+
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_header_update_crc32), header);
+}
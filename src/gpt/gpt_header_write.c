@@ -0,0 +1,58 @@
+/**
+ * \file gpt/gpt_header_write.c
+ *
+ * \brief Write a GPT header to memory.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+/**
+ * \brief Write a GPT header to a given location in RAM.
+ *
+ * \param ptr               The pointer to which this header is written.
+ * \param size              The size of this memory region.
+ * \param header            The header to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_header_write)(
+    void* ptr, size_t size, const FAT32_SYM(gpt_header)* header)
+{
+    int retval;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_header_write), ptr, size, header);
+
+    /* make sure this memory region is large enough for this header. */
+    if (size < header->header_size)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* serialize the fields in place, and clear the rest of the region. */
+    FAT32_SYM(gpt_header_encode)((uint8_t*)ptr, header);
+    memset(
+        (uint8_t*)ptr + FAT32_GPT_HEADER_SIZE, 0, size - FAT32_GPT_HEADER_SIZE);
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_header_write), retval, ptr, size, header);
+
+    return retval;
+}
@@ -0,0 +1,106 @@
+/**
+ * \file gpt/gpt_internal.h
+ *
+ * \brief Internal definitions for the partition type registry, the
+ * protective MBR template, and GPT headers.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libfat32/gpt.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The number of bits in a partition type slot index.
+ */
+#define FAT32_GPT_PARTITION_TYPE_SLOT_BITS                                  6
+
+/**
+ * \brief The number of slots in the partition type perfect hash table.
+ */
+#define FAT32_GPT_PARTITION_TYPE_SLOTS \
+    (1 << FAT32_GPT_PARTITION_TYPE_SLOT_BITS)
+
+/**
+ * \brief Map a partition type guid to its perfect hash slot.
+ *
+ * \note The low and high halves are the two little-endian 64-bit words of the
+ * on-disk guid. The generator searches for a seed that gives every registered
+ * type its own slot.
+ */
+#define FAT32_GPT_PARTITION_TYPE_SLOT(low, high, seed) \
+    ((size_t)((((low) ^ (high)) * (seed)) \
+        >> (64 - FAT32_GPT_PARTITION_TYPE_SLOT_BITS)))
+
+/**
+ * \brief The on-disk type guid of each partition type, indexed by type.
+ *
+ * \note The entry for FAT32_GPT_PARTITION_TYPE_UNKNOWN is never matched.
+ */
+extern const uint8_t FAT32_SYM(gpt_partition_type_guids)
+    [FAT32_GPT_PARTITION_TYPE_COUNT][FAT32_GUID_BINARY_SIZE];
+
+/**
+ * \brief The partition type in each perfect hash slot, or
+ * FAT32_GPT_PARTITION_TYPE_UNKNOWN for an empty slot.
+ */
+extern const uint8_t FAT32_SYM(gpt_partition_type_slots)
+    [FAT32_GPT_PARTITION_TYPE_SLOTS];
+
+/**
+ * \brief The perfect hash seed found by the generator.
+ */
+extern const uint64_t FAT32_SYM(gpt_partition_type_seed);
+
+/**
+ * \brief The offset of the span record's size in LBA in the protective MBR.
+ */
+#define FAT32_GPT_PROTECTIVE_MBR_SPAN_SIZE_OFFSET \
+    (FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET + 12)
+
+/**
+ * \brief The serialized protective MBR, with a span size in LBA of zero.
+ */
+extern const uint8_t FAT32_SYM(gpt_protective_mbr_template)
+    [FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE];
+
+/**
+ * \brief The lba of the primary GPT header.
+ */
+#define FAT32_GPT_HEADER_PRIMARY_LBA                                         1
+
+/**
+ * \brief The number of lbas in the default partition entry array.
+ */
+#define FAT32_GPT_HEADER_PARTITION_ENTRY_ARRAY_LBAS \
+    (FAT32_GPT_HEADER_PARTITION_ENTRY_COUNT \
+        * FAT32_GPT_HEADER_PARTITION_ENTRY_SIZE / 512)
+
+/**
+ * \brief The CRC-32 of a default partition entry array with no partitions.
+ *
+ * \note This is the CRC-32 of 16384 zero bytes, which the unit tests check.
+ */
+#define FAT32_GPT_HEADER_EMPTY_PARTITION_ENTRY_ARRAY_CRC32          0xAB54D286
+
+/**
+ * \brief Serialize the first FAT32_GPT_HEADER_SIZE bytes of a GPT header,
+ * including its stored header CRC.
+ *
+ * \param out               The destination, which must hold a whole header.
+ * \param header            The header to serialize.
+ */
+void FAT32_SYM(gpt_header_encode)(
+    uint8_t* out, const FAT32_SYM(gpt_header)* header);
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,75 @@
+/**
+ * \file gpt/gpt_partition_type_from_raw.c
+ *
+ * \brief Classify an on-disk partition type guid.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+/* forward decls. */
+static uint64_t load_little_endian(const uint8_t* bytes);
+
+/**
+ * \brief Classify a partition type guid in its on-disk form.
+ *
+ * \param data              The 16-byte on-disk partition type guid.
+ *
+ * \returns the partition type, or FAT32_GPT_PARTITION_TYPE_UNKNOWN if this guid
+ * isn't in the registry.
+ */
+FAT32_SYM(gpt_partition_type)
+FAT32_SYM(gpt_partition_type_from_raw)(const void* data)
+{
+    FAT32_SYM(gpt_partition_type) retval;
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_partition_type_from_raw), data);
+
+    /* the only candidate is the type in this guid's slot. */
+    size_t slot =
+        FAT32_GPT_PARTITION_TYPE_SLOT(
+            load_little_endian(bytes), load_little_endian(bytes + 8),
+            FAT32_SYM(gpt_partition_type_seed));
+    retval =
+        (FAT32_SYM(gpt_partition_type))
+            FAT32_SYM(gpt_partition_type_slots)[slot];
+
+    /* the guid must match the candidate exactly. */
+    if (
+        0 != memcmp(
+                bytes, FAT32_SYM(gpt_partition_type_guids)[retval],
+                FAT32_GUID_BINARY_SIZE))
+    {
+        retval = FAT32_GPT_PARTITION_TYPE_UNKNOWN;
+    }
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_partition_type_from_raw), retval);
+
+    return retval;
+}
+
+/**
+ * \brief Load eight bytes as a little-endian value.
+ *
+ * \param bytes             The bytes to load.
+ *
+ * \returns the value of these bytes.
+ */
+static uint64_t load_little_endian(const uint8_t* bytes)
+{
+    return
+        ((uint64_t)bytes[0])       | ((uint64_t)bytes[1] <<  8)
+      | ((uint64_t)bytes[2] << 16) | ((uint64_t)bytes[3] << 24)
+      | ((uint64_t)bytes[4] << 32) | ((uint64_t)bytes[5] << 40)
+      | ((uint64_t)bytes[6] << 48) | ((uint64_t)bytes[7] << 56);
+}
@@ -0,0 +1,56 @@
+/**
+ * \file gpt/gpt_partition_type_guid.c
+ *
+ * \brief Get the partition type guid of a well-known partition type.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+
+#include "gpt_internal.h"
+
+/**
+ * \brief Get the partition type guid of a well-known partition type.
+ *
+ * \param id                The guid to initialize.
+ * \param type              The partition type.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_partition_type_guid)(
+    FAT32_SYM(guid)* id, FAT32_SYM(gpt_partition_type) type)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_partition_type_guid), id, type);
+
+    /* only registered types have a guid. */
+    if (
+        type <= FAT32_GPT_PARTITION_TYPE_UNKNOWN
+     || type >= FAT32_GPT_PARTITION_TYPE_COUNT)
+    {
+        retval = FAT32_ERROR_GPT_BAD_PARTITION_TYPE;
+        goto done;
+    }
+
+    retval =
+        FAT32_SYM(guid_init_from_data)(
+            id, FAT32_SYM(gpt_partition_type_guids)[type],
+            FAT32_GUID_BINARY_SIZE);
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_partition_type_guid), retval, type);
+
+    return retval;
+}
@@ -0,0 +1,90 @@
+/**
+ * \file gpt/gpt_probe.c
+ *
+ * \brief Quickly classify the first two sectors of an image.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <string.h>
+
+/* The on-disk MBR signature. */
+static const uint8_t mbr_signature[2] = { 0x55, 0xAA };
+
+/* The offset of the OS type of the first partition record. */
+#define FIRST_OS_TYPE_OFFSET \
+    (FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET + 4)
+
+/**
+ * \brief Quickly classify the first two sectors of an image.
+ *
+ * \param ptr               LBA 0 and LBA 1 of the image, with 512-byte LBAs.
+ * \param size              The size of this data.
+ *
+ * \returns the classification of these sectors.
+ */
+FAT32_SYM(gpt_probe_result)
+FAT32_SYM(gpt_probe)(const void* ptr, size_t size)
+{
+    FAT32_SYM(gpt_probe_result) retval;
+    uint16_t signature, expected_signature;
+    uint32_t disk_signature;
+    uint64_t header_signature, expected_header_signature;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(gpt_probe), ptr, size);
+
+    /* verify that this memory region holds both sectors. */
+    if (size < FAT32_GPT_PROBE_MINIMUM_SIZE)
+    {
+        retval = FAT32_GPT_PROBE_BAD_SIZE;
+        goto done;
+    }
+
+    /* make working with the memory region more convenient. */
+    const uint8_t* bptr = (const uint8_t*)ptr;
+
+    /* load each field with one wide load, and compare in on-disk order. */
+    memcpy(
+        &signature, bptr + FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET,
+        sizeof(signature));
+    memcpy(&expected_signature, mbr_signature, sizeof(expected_signature));
+    memcpy(
+        &disk_signature,
+        bptr + FAT32_GPT_PROTECTIVE_MBR_UNIQUE_DISK_SIGNATURE_OFFSET,
+        sizeof(disk_signature));
+    memcpy(
+        &header_signature, bptr + FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE,
+        sizeof(header_signature));
+    memcpy(
+        &expected_header_signature, FAT32_GPT_HEADER_SIGNATURE,
+        sizeof(expected_header_signature));
+
+    if (expected_signature != signature)
+    {
+        retval = FAT32_GPT_PROBE_NO_MBR;
+    }
+    else if (0 != disk_signature || 0xEE != bptr[FIRST_OS_TYPE_OFFSET])
+    {
+        retval = FAT32_GPT_PROBE_LEGACY_MBR;
+    }
+    else if (expected_header_signature != header_signature)
+    {
+        retval = FAT32_GPT_PROBE_NO_HEADER;
+    }
+    else
+    {
+        retval = FAT32_GPT_PROBE_GPT;
+    }
+
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_probe), retval, ptr, size);
+
+    return retval;
+}
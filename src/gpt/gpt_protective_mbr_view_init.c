@@ -0,0 +1,107 @@
+/**
+ * \file gpt/gpt_protective_mbr_view_init.c
+ *
+ * \brief Validate a protective MBR in place and view it.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+FAT32_IMPORT_gpt;
+
+/* An empty partition record. */
+static const uint8_t empty_record[
+    FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_SIZE] = { 0 };
+
+/*
+ * The fixed prefix of the protective span record: not bootable, a starting
+ * CHS of 0x000200, the 0xEE OS type, an ending CHS of 0xFFFFFF, and a
+ * starting LBA of 1. Only the size in LBA varies.
+ */
+static const uint8_t span_record_prefix[12] = {
+    0x00, 0x00, 0x02, 0x00, 0xEE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00 };
+
+/**
+ * \brief Validate a protective mbr in place and view it.
+ *
+ * \param view              The view to initialize.
+ * \param ptr               The sector to view, which must outlive the view.
+ * \param size              The size of this sector.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_protective_mbr_view_init)(
+    FAT32_SYM(gpt_protective_mbr_view)* view, const void* ptr, size_t size)
+{
+    int retval;
+    gpt_protective_mbr_view tmp = { (const uint8_t*)ptr };
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_protective_mbr_view_init), view, ptr, size);
+
+    /* verify that this memory region is large enough to hold an MBR. */
+    if (size < FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* verify this signature matches UEFI specification. */
+    const uint8_t* disk_signature =
+        gpt_protective_mbr_view_unique_disk_signature(&tmp);
+    if (
+        (0 != disk_signature[0]) || (0 != disk_signature[1])
+     || (0 != disk_signature[2]) || (0 != disk_signature[3]))
+    {
+        retval = FAT32_ERROR_GPT_BAD_RECORD;
+        goto done;
+    }
+
+    /* each partition record is either empty or the protective span. */
+    for (size_t i = 0; i < 4; ++i)
+    {
+        const uint8_t* rec = gpt_protective_mbr_view_record(&tmp, i);
+
+        if (
+            0 != memcmp(rec, empty_record, sizeof(empty_record))
+         && (0 != memcmp(rec, span_record_prefix, sizeof(span_record_prefix))
+          || gpt_protective_mbr_view_record_size_in_lba(&tmp, i) < 33))
+        {
+            retval = FAT32_ERROR_GPT_BAD_RECORD;
+            goto done;
+        }
+    }
+
+    /* the first partition record should be the EFI record. */
+    if (0xEE != gpt_protective_mbr_view_record_os_type(&tmp, 0))
+    {
+        retval = FAT32_ERROR_GPT_BAD_RECORD;
+        goto done;
+    }
+
+    /* verify signature. */
+    if (0xAA55 != gpt_protective_mbr_view_signature(&tmp))
+    {
+        retval = FAT32_ERROR_GPT_MBR_BAD_SIGNATURE;
+        goto done;
+    }
+
+    *view = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_protective_mbr_view_init), retval, view, ptr, size);
+
+    return retval;
+}
@@ -0,0 +1,87 @@
+/**
+ * \file gpt/gpt_protective_mbr_write_span.c
+ *
+ * \brief Write a protective MBR spanning an entire disk from a template.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+#include "gpt_internal.h"
+
+/**
+ * \brief Write a protective mbr spanning the entire disk to a given location in
+ * RAM.
+ *
+ * \param ptr               The pointer to which this record is written.
+ * \param size              The size of this memory region.
+ * \param disk_size         Size of the entire disk in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_protective_mbr_write_span)(
+    void* ptr, size_t size, size_t disk_size)
+{
+    int retval;
+
+    /* function contract preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_protective_mbr_write_span), ptr, size, disk_size);
+
+    /* the disk must be at least large enough to hold GPT records. */
+    if (disk_size < (512UL * 34UL))
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* make sure this memory region is at least large enough for this MBR. */
+    if (size < FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE)
+    {
+        retval = FAT32_ERROR_GPT_BAD_SIZE;
+        goto done;
+    }
+
+    /* compute the disk size in sectors. */
+    size_t lba_size = (disk_size / 512UL) - 1UL;
+    if (lba_size > 0xFFFFFFFF)
+    {
+        lba_size = 0xFFFFFFFF;
+    }
+
+    /* make working with this pointer more convenient. */
+    uint8_t* bptr = (uint8_t*)ptr;
+
+    /* copy the template, and clear the rest of the region as write does. */
+    memcpy(
+        bptr, FAT32_SYM(gpt_protective_mbr_template),
+        FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE);
+    memset(
+        bptr + FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE, 0,
+        size - FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE);
+
+    /* patch the size in lba of the span record as little endian. */
+    bptr += FAT32_GPT_PROTECTIVE_MBR_SPAN_SIZE_OFFSET;
+    bptr[0] = (lba_size      ) & 0xFF;
+    bptr[1] = (lba_size >>  8) & 0xFF;
+    bptr[2] = (lba_size >> 16) & 0xFF;
+    bptr[3] = (lba_size >> 24) & 0xFF;
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* function contract postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(gpt_protective_mbr_write_span), retval, ptr, size,
+        disk_size);
+
+    return retval;
+}
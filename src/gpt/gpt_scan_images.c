@@ -0,0 +1,412 @@
+/**
+ * \file gpt/gpt_scan_images.c
+ *
+ * \brief Classify a list of raw images on a pool of workers.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+FAT32_IMPORT_gpt;
+
+/* The size of an LBA. */
+#define SCAN_LBA_SIZE                                                     512
+
+/* The first read covers LBA 0 through 33. */
+#define SCAN_WINDOW_SIZE                                  (34 * SCAN_LBA_SIZE)
+
+/* The size of the read buffer of each worker. */
+#define SCAN_BUFFER_SIZE \
+    (SCAN_WINDOW_SIZE + FAT32_GPT_SCAN_MAX_ENTRY_ARRAY_SIZE)
+
+/* The number of images a worker claims at a time. */
+#define SCAN_BATCH_SIZE                                                    16
+
+/* The offsets of the entry array fields in the GPT header at LBA 1. */
+#define SCAN_PARTITION_ENTRY_LBA_OFFSET                  (SCAN_LBA_SIZE + 72)
+#define SCAN_NUMBER_OF_PARTITION_ENTRIES_OFFSET          (SCAN_LBA_SIZE + 80)
+#define SCAN_SIZE_OF_PARTITION_ENTRY_OFFSET              (SCAN_LBA_SIZE + 84)
+
+/* every partition type fits in the type mask. */
+_Static_assert(
+    FAT32_GPT_PARTITION_TYPE_COUNT <= 32,
+    "the partition type mask must hold every partition type");
+
+/**
+ * \brief The work shared by all workers of a scan.
+ */
+typedef struct scan_context scan_context;
+
+struct scan_context
+{
+    FAT32_SYM(gpt_scan_result)* results;
+    const char* const* paths;
+    size_t count;
+    /* the index of the next batch of images to claim. */
+    _Atomic size_t next;
+};
+
+/* forward decls. */
+static void* worker_thread(void* context);
+static void run_worker(scan_context* ctx, uint8_t* buffer);
+static void scan_image(
+    FAT32_SYM(gpt_scan_result)* result, const char* path, uint8_t* buffer);
+static int read_fully(
+    int fd, uint8_t* buffer, size_t size, uint64_t offset, size_t* read_size);
+static void summarize_entries(
+    FAT32_SYM(gpt_scan_result)* result, const uint8_t* entries,
+    uint32_t count, uint32_t size);
+static uint32_t load_le32(const uint8_t* p);
+static uint64_t load_le64(const uint8_t* p);
+
+/**
+ * \brief Classify a list of raw images and summarize their partitions.
+ *
+ * \param results           The array of results, one per path.
+ * \param paths             The array of image paths.
+ * \param count             The number of images.
+ * \param threads           The number of workers, or 0 for one per CPU.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, in which case each result holds the status
+ *        of its image.
+ *      - FAT32_ERROR_GPT_SCAN_OUT_OF_MEMORY if the calling thread can't
+ *        allocate its read buffer.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(gpt_scan_images)(
+    FAT32_SYM(gpt_scan_result)* results, const char* const* paths,
+    size_t count, size_t threads)
+{
+    int retval;
+    uint8_t* buffer = NULL;
+    pthread_t* pool = NULL;
+    size_t started = 0;
+    scan_context ctx = { results, paths, count, 0 };
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(gpt_scan_images), results, paths, count, threads);
+
+    /* the calling thread always works, so it needs a buffer. */
+    buffer = (uint8_t*)malloc(SCAN_BUFFER_SIZE);
+    if (NULL == buffer)
+    {
+        retval = FAT32_ERROR_GPT_SCAN_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    if (0 == threads)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    /* there is no use for more workers than batches. */
+    size_t batches = (count + SCAN_BATCH_SIZE - 1) / SCAN_BATCH_SIZE;
+    if (threads > batches)
+    {
+        threads = batches > 0 ? batches : 1;
+    }
+
+    /* start the helpers; if any can't start, the rest share its work. */
+    if (threads > 1)
+    {
+        pool = (pthread_t*)malloc((threads - 1) * sizeof(*pool));
+        for (; NULL != pool && started < threads - 1; ++started)
+        {
+            if (
+                0 != pthread_create(pool + started, NULL, &worker_thread, &ctx))
+            {
+                break;
+            }
+        }
+    }
+
+    run_worker(&ctx, buffer);
+
+    for (size_t i = 0; i < started; ++i)
+    {
+        pthread_join(pool[i], NULL);
+    }
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    free(pool);
+    free(buffer);
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(FAT32_SYM(gpt_scan_images), retval);
+
+    return retval;
+}
+
+/**
+ * \brief Run a helper worker with its own buffer.
+ *
+ * \param context           The scan context.
+ *
+ * \returns NULL.
+ */
+static void* worker_thread(void* context)
+{
+    /* without a buffer, this helper leaves its share to the others. */
+    uint8_t* buffer = (uint8_t*)malloc(SCAN_BUFFER_SIZE);
+    if (NULL != buffer)
+    {
+        run_worker((scan_context*)context, buffer);
+        free(buffer);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Claim and scan batches of images until none are left.
+ *
+ * \param ctx               The scan context.
+ * \param buffer            The read buffer of this worker.
+ */
+static void run_worker(scan_context* ctx, uint8_t* buffer)
+{
+    for (;;)
+    {
+        size_t begin =
+            atomic_fetch_add_explicit(
+                &ctx->next, SCAN_BATCH_SIZE, memory_order_relaxed);
+        if (begin >= ctx->count)
+        {
+            return;
+        }
+
+        size_t end =
+            ctx->count - begin < SCAN_BATCH_SIZE
+                ? ctx->count : begin + SCAN_BATCH_SIZE;
+        for (size_t i = begin; i < end; ++i)
+        {
+            scan_image(ctx->results + i, ctx->paths[i], buffer);
+        }
+    }
+}
+
+/**
+ * \brief Classify one image and summarize its partitions.
+ *
+ * \param result            The result to fill.
+ * \param path              The path of the image.
+ * \param buffer            The read buffer of this worker.
+ */
+static void scan_image(
+    FAT32_SYM(gpt_scan_result)* result, const char* path, uint8_t* buffer)
+{
+    int fd;
+    size_t size;
+    gpt_protective_mbr_view view;
+
+    memset(result, 0, sizeof(*result));
+    result->probe = FAT32_GPT_PROBE_BAD_SIZE;
+    result->mbr_status = FAT32_ERROR_GPT_BAD_RECORD;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        result->status = FAT32_ERROR_GPT_SCAN_OPEN;
+        goto done;
+    }
+
+    /* a single read covers LBA 0 through 33. */
+    result->status = read_fully(fd, buffer, SCAN_WINDOW_SIZE, 0, &size);
+    if (STATUS_SUCCESS != result->status)
+    {
+        goto done;
+    }
+
+    result->probe = gpt_probe(buffer, size);
+    if (result->probe < FAT32_GPT_PROBE_NO_HEADER)
+    {
+        goto done;
+    }
+
+    result->mbr_status = gpt_protective_mbr_view_init(&view, buffer, size);
+    if (STATUS_SUCCESS != result->mbr_status)
+    {
+        goto done;
+    }
+
+    result->protective_size_in_lba =
+        gpt_protective_mbr_view_record_size_in_lba(&view, 0);
+    if (FAT32_GPT_PROBE_GPT != result->probe)
+    {
+        goto done;
+    }
+
+    /* find the primary partition entry array. */
+    uint64_t entry_lba = load_le64(buffer + SCAN_PARTITION_ENTRY_LBA_OFFSET);
+    uint32_t entry_count =
+        load_le32(buffer + SCAN_NUMBER_OF_PARTITION_ENTRIES_OFFSET);
+    uint32_t entry_size =
+        load_le32(buffer + SCAN_SIZE_OF_PARTITION_ENTRY_OFFSET);
+    uint64_t array_size = (uint64_t)entry_count * entry_size;
+
+    /* entries are 128 << n bytes, and the array follows the header and ends
+     * at a file offset that pread can reach. */
+    if (
+        entry_size < 128 || 0 != (entry_size & (entry_size - 1))
+     || entry_lba < 2
+     || entry_lba
+            > (INT64_MAX - FAT32_GPT_SCAN_MAX_ENTRY_ARRAY_SIZE) / SCAN_LBA_SIZE
+     || array_size > FAT32_GPT_SCAN_MAX_ENTRY_ARRAY_SIZE)
+    {
+        result->status = FAT32_ERROR_GPT_SCAN_BAD_ENTRY_ARRAY;
+        goto done;
+    }
+
+    result->partition_entry_count = entry_count;
+
+    /* the array is usually inside the first read; this test can't wrap. */
+    const uint8_t* entries;
+    uint64_t array_offset = entry_lba * SCAN_LBA_SIZE;
+    if (array_size <= size && array_offset <= size - array_size)
+    {
+        entries = buffer + array_offset;
+    }
+    else
+    {
+        size_t array_read;
+
+        result->status =
+            read_fully(
+                fd, buffer + SCAN_WINDOW_SIZE, (size_t)array_size,
+                array_offset, &array_read);
+        if (STATUS_SUCCESS != result->status)
+        {
+            goto done;
+        }
+
+        if (array_read != array_size)
+        {
+            result->status = FAT32_ERROR_GPT_SCAN_BAD_ENTRY_ARRAY;
+            goto done;
+        }
+
+        entries = buffer + SCAN_WINDOW_SIZE;
+    }
+
+    summarize_entries(result, entries, entry_count, entry_size);
+
+done:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+/**
+ * \brief Read until a buffer is full or the file ends.
+ *
+ * \param fd                The file to read.
+ * \param buffer            The buffer to fill.
+ * \param size              The size of the buffer.
+ * \param offset            The file offset to read from.
+ * \param read_size         Set to the number of bytes read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GPT_SCAN_READ if the file can't be read.
+ */
+static int read_fully(
+    int fd, uint8_t* buffer, size_t size, uint64_t offset, size_t* read_size)
+{
+    *read_size = 0;
+
+    while (*read_size < size)
+    {
+        ssize_t count =
+            pread(
+                fd, buffer + *read_size, size - *read_size,
+                (off_t)(offset + *read_size));
+        if (count < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            return FAT32_ERROR_GPT_SCAN_READ;
+        }
+
+        /* the file ended. */
+        if (0 == count)
+        {
+            break;
+        }
+
+        *read_size += (size_t)count;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Count the entries in use and collect their partition types.
+ *
+ * \param result            The result to update.
+ * \param entries           The partition entry array.
+ * \param count             The number of entries.
+ * \param size              The size of each entry.
+ */
+static void summarize_entries(
+    FAT32_SYM(gpt_scan_result)* result, const uint8_t* entries,
+    uint32_t count, uint32_t size)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        /* the partition type guid starts each entry. */
+        gpt_partition_type type =
+            gpt_partition_type_from_raw(entries + (size_t)i * size);
+
+        if (FAT32_GPT_PARTITION_TYPE_UNUSED != type)
+        {
+            ++result->partition_count;
+            result->partition_type_mask |= UINT32_C(1) << type;
+        }
+    }
+}
+
+/**
+ * \brief Load a little-endian 32-bit word.
+ *
+ * \param p                 The four bytes to load.
+ *
+ * \returns the word.
+ */
+static uint32_t load_le32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0])       | ((uint32_t)p[1] <<  8)
+      | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * \brief Load a little-endian 64-bit word.
+ *
+ * \param p                 The eight bytes to load.
+ *
+ * \returns the word.
+ */
+static uint64_t load_le64(const uint8_t* p)
+{
+    return ((uint64_t)load_le32(p + 4) << 32) | load_le32(p);
+}
@@ -0,0 +1,64 @@
+/**
+ * \file guid/guid_chacha20_block.c
+ *
+ * \brief The ChaCha20 block function.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "guid_internal.h"
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTER_ROUND(a, b, c, d) \
+    do { \
+        a += b; d ^= a; d = ROTL32(d, 16); \
+        c += d; b ^= c; b = ROTL32(b, 12); \
+        a += b; d ^= a; d = ROTL32(d,  8); \
+        c += d; b ^= c; b = ROTL32(b,  7); \
+    } while (0)
+
+/**
+ * \brief Run the ChaCha20 block function.
+ *
+ * \param out               The 64-byte keystream block, as sixteen
+ *                          little-endian words.
+ * \param key               The 256-bit key, as eight little-endian words.
+ * \param counter           The block counter.
+ * \param nonce             The 96-bit nonce, as three little-endian words.
+ */
+void FAT32_SYM(guid_chacha20_block)(
+    uint32_t out[16], const uint32_t key[8], uint32_t counter,
+    const uint32_t nonce[3])
+{
+    uint32_t state[16] = {
+        /* "expand 32-byte k". */
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        counter, nonce[0], nonce[1], nonce[2] };
+    uint32_t x[16];
+
+    for (int i = 0; i < 16; ++i)
+    {
+        x[i] = state[i];
+    }
+
+    /* ten double rounds: a column round, then a diagonal round. */
+    for (int i = 0; i < 10; ++i)
+    {
+        QUARTER_ROUND(x[0], x[4], x[ 8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[ 9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[ 8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[ 9], x[14]);
+    }
+
+    for (int i = 0; i < 16; ++i)
+    {
+        out[i] = x[i] + state[i];
+    }
+}
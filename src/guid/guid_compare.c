@@ -0,0 +1,78 @@
+/**
+ * \file guid/guid_compare.c
+ *
+ * \brief Order two guids.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+
+/* forward decls. */
+static uint64_t high_key(const FAT32_SYM(guid)* id);
+static uint64_t load_big_endian(const uint8_t* bytes);
+
+/**
+ * \brief Compare two guids.
+ *
+ * \param lhs               The left-hand guid.
+ * \param rhs               The right-hand guid.
+ *
+ * \returns a negative value if lhs orders before rhs, zero if they are equal,
+ * and a positive value if lhs orders after rhs.
+ */
+int FAT32_SYM(guid_compare)(
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(guid_compare), lhs, rhs);
+
+    /* compare the guids as two big-endian 64-bit keys. */
+    uint64_t lhs_key = high_key(lhs);
+    uint64_t rhs_key = high_key(rhs);
+    if (lhs_key == rhs_key)
+    {
+        lhs_key = load_big_endian(lhs->data4);
+        rhs_key = load_big_endian(rhs->data4);
+    }
+
+    retval = (lhs_key > rhs_key) - (lhs_key < rhs_key);
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_compare), retval, lhs, rhs);
+
+    return retval;
+}
+
+/**
+ * \brief Get the key of data1, data2, and data3.
+ *
+ * \param id                The guid.
+ *
+ * \returns the high key of this guid.
+ */
+static uint64_t high_key(const FAT32_SYM(guid)* id)
+{
+    return
+        ((uint64_t)id->data1 << 32) | ((uint64_t)id->data2 << 16) | id->data3;
+}
+
+/**
+ * \brief Load eight bytes as a big-endian value.
+ *
+ * \param bytes             The bytes to load.
+ *
+ * \returns the value of these bytes.
+ */
+static uint64_t load_big_endian(const uint8_t* bytes)
+{
+    return
+        ((uint64_t)bytes[0] << 56) | ((uint64_t)bytes[1] << 48)
+      | ((uint64_t)bytes[2] << 40) | ((uint64_t)bytes[3] << 32)
+      | ((uint64_t)bytes[4] << 24) | ((uint64_t)bytes[5] << 16)
+      | ((uint64_t)bytes[6] <<  8) | ((uint64_t)bytes[7]);
+}
@@ -0,0 +1,40 @@
+/**
+ * \file guid/guid_equal.c
+ *
+ * \brief Compare two guids for equality.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <string.h>
+
+/**
+ * \brief Returns true if two guids are equal.
+ *
+ * \param lhs               The left-hand guid.
+ * \param rhs               The right-hand guid.
+ *
+ * \returns true if these guids are equal and false otherwise.
+ */
+bool FAT32_SYM(guid_equal)(
+    const FAT32_SYM(guid)* lhs, const FAT32_SYM(guid)* rhs)
+{
+    bool retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(guid_equal), lhs, rhs);
+
+    /* the guid has no padding, so this compiles to two 64-bit compares. */
+    _Static_assert(
+        FAT32_GUID_BINARY_SIZE == sizeof(FAT32_SYM(guid)),
+        "guids must not contain padding.");
+    retval = 0 == memcmp(lhs, rhs, sizeof(*lhs));
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_equal), retval, lhs, rhs);
+
+    return retval;
+}
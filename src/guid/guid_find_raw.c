@@ -0,0 +1,59 @@
+/**
+ * \file guid/guid_find_raw.c
+ *
+ * \brief Find a guid in an array of raw on-disk records.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <string.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Find the first matching guid in an array of raw on-disk records.
+ *
+ * \param base              The on-disk guid of the first record.
+ * \param stride            The distance in bytes between records.
+ * \param count             The number of records.
+ * \param target            The guid to find.
+ *
+ * \returns the index of the first matching record, or count if no record
+ * matches.
+ */
+size_t FAT32_SYM(guid_find_raw)(
+    const void* base, size_t stride, size_t count,
+    const FAT32_SYM(guid)* target)
+{
+    size_t retval;
+    const uint8_t* bbase = (const uint8_t*)base;
+    uint8_t raw[FAT32_GUID_BINARY_SIZE];
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_find_raw), base, stride, count, target);
+
+    /* encode the target once for every compare. */
+    guid_encode_raw(raw, target);
+
+#if defined(__x86_64__) && !defined(CBMC)
+    /* SSE2 is part of the x86-64 baseline. */
+    retval = FAT32_SYM(guid_find_raw_sse2)(bbase, stride, count, raw);
+#else
+    for (retval = 0; retval < count; ++retval)
+    {
+        if (0 == memcmp(bbase + retval * stride, raw, sizeof(raw)))
+        {
+            break;
+        }
+    }
+#endif
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_find_raw), retval, base, stride, count, target);
+
+    return retval;
+}
@@ -0,0 +1,77 @@
+/**
+ * \file guid/guid_find_raw_sse2.c
+ *
+ * \brief Find a raw guid in an array of on-disk records using SSE2 compares.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "guid_internal.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+#include <emmintrin.h>
+
+/**
+ * \brief Compare the guid of one record against the target.
+ *
+ * \param record            The on-disk guid of the record.
+ * \param target            The raw target guid.
+ *
+ * \returns the byte equality mask of the compare.
+ */
+static inline __m128i match(const uint8_t* record, __m128i target)
+{
+    return _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)record), target);
+}
+
+/**
+ * \brief Find the first record whose on-disk guid matches a raw guid.
+ *
+ * \param base              The on-disk guid of the first record.
+ * \param stride            The distance in bytes between records.
+ * \param count             The number of records.
+ * \param raw               The raw target guid.
+ *
+ * \returns the index of the first matching record, or count if no record
+ * matches.
+ */
+size_t FAT32_SYM(guid_find_raw_sse2)(
+    const uint8_t* base, size_t stride, size_t count,
+    const uint8_t raw[FAT32_GUID_BINARY_SIZE])
+{
+    __m128i target = _mm_loadu_si128((const __m128i*)raw);
+    size_t i = 0;
+
+    /* check four records per step, with a single branch for all four. */
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint8_t* record = base + i * stride;
+        int k0 = _mm_movemask_epi8(match(record, target));
+        int k1 = _mm_movemask_epi8(match(record + stride, target));
+        int k2 = _mm_movemask_epi8(match(record + 2 * stride, target));
+        int k3 = _mm_movemask_epi8(match(record + 3 * stride, target));
+
+        /* a record matches only if all sixteen of its bytes are equal. */
+        if ((0xffff == k0) | (0xffff == k1) | (0xffff == k2) | (0xffff == k3))
+        {
+            return
+                0xffff == k0 ? i
+              : 0xffff == k1 ? i + 1
+              : 0xffff == k2 ? i + 2 : i + 3;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        if (0xffff == _mm_movemask_epi8(match(base + i * stride, target)))
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+#endif
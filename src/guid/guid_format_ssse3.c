@@ -0,0 +1,118 @@
+/**
+ * \file guid/guid_format_ssse3.c
+ *
+ * \brief Write a guid in the canonical string form using SSSE3 shuffles.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "guid_internal.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+#include <immintrin.h>
+
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+
+/* the guid is loaded with a single 16-byte load. */
+_Static_assert(
+    FAT32_GUID_BINARY_SIZE == sizeof(FAT32_SYM(guid)),
+    "the guid must have no padding");
+
+/*
+ * Reorder the in-memory guid layout into string order, swapping data1, data2,
+ * and data3 from host (little-endian) order.
+ */
+static const int8_t string_order[16] = {
+    3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+/* The hex character of each nibble value. */
+static const int8_t hex_digits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+/*
+ * Spread the 32 digits over the three overlapping stores of the string, which
+ * cover bytes 0-15, 16-31, and 20-35. Each 0x80 leaves a gap for a dash.
+ */
+static const int8_t spread_0_lo[16] = {
+    0, 1, 2, 3, 4, 5, 6, 7, -128, 8, 9, 10, 11, -128, 12, 13 };
+static const int8_t spread_16_lo[16] = {
+    14, 15, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128 };
+static const int8_t spread_16_hi[16] = {
+    -128, -128, -128, 0, 1, 2, 3, -128, 4, 5, 6, 7, 8, 9, 10, 11 };
+static const int8_t spread_20_hi[16] = {
+    1, 2, 3, -128, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+/* The dashes of each store. */
+static const int8_t dashes_0[16] = {
+    0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0 };
+static const int8_t dashes_16[16] = {
+    0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0 };
+static const int8_t dashes_20[16] = {
+    0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/**
+ * \brief Load a shuffle or character constant.
+ *
+ * \param table             The sixteen bytes to load.
+ *
+ * \returns the constant.
+ */
+static inline SSSE3_TARGET __m128i load_const(const int8_t* table)
+{
+    return _mm_loadu_si128((const __m128i*)table);
+}
+
+/**
+ * \brief Write a guid in the canonical string form using SSSE3 shuffles.
+ *
+ * \param str               The string buffer.
+ * \param id                The guid to write.
+ */
+SSSE3_TARGET
+void FAT32_SYM(guid_format_ssse3)(char* str, const FAT32_SYM(guid)* id)
+{
+    __m128i bytes, hi, lo, digits_lo, digits_hi, out;
+    __m128i mask = _mm_set1_epi8(0x0f);
+
+    /* load the guid bytes in string order. */
+    bytes = _mm_loadu_si128((const __m128i*)id);
+    bytes = _mm_shuffle_epi8(bytes, load_const(string_order));
+
+    /* split each byte into its high and low nibbles, in string order. */
+    hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    lo = _mm_and_si128(bytes, mask);
+    digits_lo = _mm_unpacklo_epi8(hi, lo);
+    digits_hi = _mm_unpackhi_epi8(hi, lo);
+
+    /* map each nibble to its hex character. */
+    digits_lo = _mm_shuffle_epi8(load_const(hex_digits), digits_lo);
+    digits_hi = _mm_shuffle_epi8(load_const(hex_digits), digits_hi);
+
+    /* bytes 0-15. */
+    out = _mm_or_si128(
+            _mm_shuffle_epi8(digits_lo, load_const(spread_0_lo)),
+            load_const(dashes_0));
+    _mm_storeu_si128((__m128i*)(str + 0), out);
+
+    /* bytes 16-31. */
+    out = _mm_or_si128(
+            _mm_or_si128(
+                _mm_shuffle_epi8(digits_lo, load_const(spread_16_lo)),
+                _mm_shuffle_epi8(digits_hi, load_const(spread_16_hi))),
+            load_const(dashes_16));
+    _mm_storeu_si128((__m128i*)(str + 16), out);
+
+    /* bytes 20-35, overlapping the previous store with the same bytes. */
+    out = _mm_or_si128(
+            _mm_shuffle_epi8(digits_hi, load_const(spread_20_hi)),
+            load_const(dashes_20));
+    _mm_storeu_si128((__m128i*)(str + 20), out);
+
+    str[36] = 0;
+}
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * \file guid/guid_generate_v4.c
+ *
+ * \brief Initialize a guid with a new random (version 4) value.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Initialize a guid with a new random (version 4) value.
+ *
+ * \param id                The guid to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_generate_v4)(FAT32_SYM(guid)* id)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(guid_generate_v4), id);
+
+    retval = FAT32_SYM(guid_generate_v4_n)(id, 1);
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_generate_v4), retval, id);
+
+    return retval;
+}
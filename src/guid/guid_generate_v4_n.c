@@ -0,0 +1,57 @@
+/**
+ * \file guid/guid_generate_v4_n.c
+ *
+ * \brief Initialize an array of guids with new random (version 4) values.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Initialize an array of guids with new random (version 4) values.
+ *
+ * \param ids               The guids to initialize.
+ * \param count             The number of guids.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_generate_v4_n)(FAT32_SYM(guid)* ids, size_t count)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_generate_v4_n), ids, count);
+
+    /* every field of a random guid is random, so fill them in place. */
+    retval = FAT32_SYM(guid_random_bytes)(ids, count * sizeof(*ids));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* set the version and variant fields of RFC 9562. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        ids[i].data3 = (uint16_t)((ids[i].data3 & 0x0fff) | 0x4000);
+        ids[i].data4[0] = (uint8_t)((ids[i].data4[0] & 0x3f) | 0x80);
+    }
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_generate_v4_n), retval, ids, count);
+
+    return retval;
+}
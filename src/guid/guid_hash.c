@@ -0,0 +1,56 @@
+/**
+ * \file guid/guid_hash.c
+ *
+ * \brief Hash a guid.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+
+#define ROTL64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+/**
+ * \brief Hash a guid.
+ *
+ * \note The two halves of the binary form are multiplied by odd constants and
+ * combined, then run through the MurmurHash3 64-bit finalizer so that every
+ * input bit affects every output bit.
+ *
+ * \param id                The guid to hash.
+ *
+ * \returns the 64-bit hash of this guid.
+ */
+uint64_t FAT32_SYM(guid_hash)(const FAT32_SYM(guid)* id)
+{
+    uint64_t retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(guid_hash), id);
+
+    /* the binary form, as two little-endian words. On a little-endian host,
+     * this compiles to two loads. */
+    uint64_t low =
+        (uint64_t)id->data1 | ((uint64_t)id->data2 << 32)
+      | ((uint64_t)id->data3 << 48);
+    uint64_t high =
+        (uint64_t)id->data4[0]         | ((uint64_t)id->data4[1] <<  8)
+      | ((uint64_t)id->data4[2] << 16) | ((uint64_t)id->data4[3] << 24)
+      | ((uint64_t)id->data4[4] << 32) | ((uint64_t)id->data4[5] << 40)
+      | ((uint64_t)id->data4[6] << 48) | ((uint64_t)id->data4[7] << 56);
+
+    retval =
+        (low * 0x9e3779b97f4a7c15) ^ ROTL64(high * 0xc2b2ae3d27d4eb4f, 32);
+
+    retval ^= retval >> 33;
+    retval *= 0xff51afd7ed558ccd;
+    retval ^= retval >> 33;
+    retval *= 0xc4ceb9fe1a85ec53;
+    retval ^= retval >> 33;
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(FAT32_SYM(guid_hash), retval, id);
+
+    return retval;
+}
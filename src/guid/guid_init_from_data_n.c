@@ -0,0 +1,76 @@
+/**
+ * \file guid/guid_init_from_data_n.c
+ *
+ * \brief Initialize an array of guids from an array of binary data.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * \brief Initialize an array of guids from an array of binary data.
+ *
+ * \param ids               The guids to initialize.
+ * \param count             The number of guids.
+ * \param ptr               Pointer to the binary data from which these guids
+ *                          are initialized, FAT32_GUID_BINARY_SIZE bytes each.
+ * \param size              The size of this data, which must be exactly count
+ *                          guids.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          initialized, or to count on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_init_from_data_n)(
+    FAT32_SYM(guid)* ids, size_t count, const void* ptr, size_t size,
+    size_t* failed_index)
+{
+    int retval;
+    const uint8_t* bptr = (const uint8_t*)ptr;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_init_from_data_n), ids, count, ptr, size,
+        failed_index);
+
+    /* verify that the binary data holds exactly count guids. */
+    if (
+        count > SIZE_MAX / FAT32_GUID_BINARY_SIZE
+     || size != count * FAT32_GUID_BINARY_SIZE)
+    {
+        *failed_index = 0;
+        retval = FAT32_ERROR_GUID_DATA_INVALID_SIZE;
+        goto done;
+    }
+
+    /* decode each little-endian field without branching. */
+    for (size_t i = 0; i < count; ++i, bptr += FAT32_GUID_BINARY_SIZE)
+    {
+        ids[i].data1 =
+            ((uint32_t)bptr[0])       | ((uint32_t)bptr[1] << 8)
+          | ((uint32_t)bptr[2] << 16) | ((uint32_t)bptr[3] << 24);
+        ids[i].data2 = (uint16_t)(bptr[4] | (bptr[5] << 8));
+        ids[i].data3 = (uint16_t)(bptr[6] | (bptr[7] << 8));
+        memcpy(ids[i].data4, bptr + 8, sizeof(ids[i].data4));
+    }
+
+    *failed_index = count;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_init_from_data_n), retval, ids, count, ptr, size,
+        failed_index);
+
+    return retval;
+}
@@ -0,0 +1,77 @@
+/**
+ * \file guid/guid_init_from_name.c
+ *
+ * \brief Initialize a guid with a name-based (version 5) value.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Initialize a guid with a name-based (version 5) value.
+ *
+ * \param id                The guid to initialize.
+ * \param ns                The namespace guid.
+ * \param name              The name bytes.
+ * \param size              The size of the name.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_init_from_name)(
+    FAT32_SYM(guid)* id, const FAT32_SYM(guid)* ns, const void* name,
+    size_t size)
+{
+    int retval;
+    uint8_t prefix[FAT32_GUID_BINARY_SIZE];
+    uint8_t digest[20];
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_init_from_name), id, ns, name, size);
+
+    /* the namespace is hashed in its big-endian (string order) form. */
+    prefix[0] = (uint8_t)(ns->data1 >> 24);
+    prefix[1] = (uint8_t)(ns->data1 >> 16);
+    prefix[2] = (uint8_t)(ns->data1 >> 8);
+    prefix[3] = (uint8_t)(ns->data1);
+    prefix[4] = (uint8_t)(ns->data2 >> 8);
+    prefix[5] = (uint8_t)(ns->data2);
+    prefix[6] = (uint8_t)(ns->data3 >> 8);
+    prefix[7] = (uint8_t)(ns->data3);
+    for (int i = 0; i < 8; ++i)
+    {
+        prefix[8 + i] = ns->data4[i];
+    }
+
+    FAT32_SYM(guid_sha1)(digest, prefix, sizeof(prefix), name, size);
+
+    /* the first 16 digest bytes become the guid, in the same order. */
+    id->data1 =
+        ((uint32_t)digest[0] << 24) | ((uint32_t)digest[1] << 16)
+      | ((uint32_t)digest[2] << 8) | ((uint32_t)digest[3]);
+    id->data2 = (uint16_t)((digest[4] << 8) | digest[5]);
+    id->data3 = (uint16_t)((digest[6] << 8) | digest[7]);
+    for (int i = 0; i < 8; ++i)
+    {
+        id->data4[i] = digest[8 + i];
+    }
+
+    /* set the version 5 and variant 1 bits. */
+    id->data3 = (uint16_t)((id->data3 & 0x0fff) | 0x5000);
+    id->data4[0] = (uint8_t)((id->data4[0] & 0x3f) | 0x80);
+
+    retval = STATUS_SUCCESS;
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_init_from_name), retval, id);
+
+    return retval;
+}
@@ -11,6 +11,9 @@
 #include <libfat32/status.h>
 #include <string.h>
 
+#include "../cpu/cpu_internal.h"
+#include "guid_internal.h"
+
 #ifdef CBMC
 int isxdigit(int c);
 #else
@@ -23,6 +26,11 @@ static uint32_t convert_digits(const uint8_t* digits, size_t count);
 /**
  * \brief Initialize a guid from a string.
  *
+ * \note Strings in the canonical form are parsed with SIMD shuffles where the
+ * host supports them. Any other string, or any string the fast path rejects,
+ * goes through the tolerant parser, which accepts any 32 hex digits separated
+ * by non-hex characters.
+ *
  * \param id                The guid to initialize.
  * \param str               The input string from which this guid is
  *                          initialized.
@@ -42,6 +50,19 @@ FAT32_SYM(guid_init_from_string)(FAT32_SYM(guid)* id, const char* str)
     MODEL_CONTRACT_CHECK_PRECONDITIONS(
         FAT32_SYM(guid_init_from_string), id, str);
 
+#if defined(__x86_64__) && !defined(CBMC)
+    /* parse the canonical form without scanning digit by digit. */
+    if (
+        (FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3)
+     && FAT32_GUID_CANONICAL_LENGTH
+            == strnlen(str, FAT32_GUID_CANONICAL_LENGTH + 1)
+     && FAT32_SYM(guid_parse_canonical_ssse3)(id, str))
+    {
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+#endif
+
     /* iterate through all digits of the sequence. */
     for (; 0 != *str; ++str)
     {
@@ -0,0 +1,104 @@
+/**
+ * \file guid/guid_init_from_string_n.c
+ *
+ * \brief Initialize an array of guids from an array of strings.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <string.h>
+
+#include "../cpu/cpu_internal.h"
+#include "guid_internal.h"
+
+/**
+ * \brief Initialize an array of guids from an array of strings.
+ *
+ * \param ids               The guids to initialize.
+ * \param count             The number of guids.
+ * \param str               The input strings.
+ * \param size              The size of the input strings in bytes.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          initialized, or to count on success. The guids
+ *                          before this index are initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_init_from_string_n)(
+    FAT32_SYM(guid)* ids, size_t count, const char* str, size_t size,
+    size_t* failed_index)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_init_from_string_n), ids, count, str, size,
+        failed_index);
+
+#if defined(__x86_64__) && !defined(CBMC)
+    /* select the canonical parser once for the whole array. */
+    bool canonical_kernel =
+        0 != (FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3);
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        /* the slot must be in the buffer, and its string must end in it. */
+        if (size < FAT32_GUID_STRING_SIZE)
+        {
+            retval = FAT32_ERROR_GUID_STRING_BAD;
+            *failed_index = i;
+            goto done;
+        }
+
+        const char* term = memchr(str, 0, FAT32_GUID_STRING_SIZE);
+        if (NULL == term)
+        {
+            retval = FAT32_ERROR_GUID_STRING_BAD;
+            *failed_index = i;
+            goto done;
+        }
+
+#if defined(__x86_64__) && !defined(CBMC)
+        /* parse canonical strings directly. */
+        if (
+            canonical_kernel
+         && FAT32_GUID_CANONICAL_LENGTH == term - str
+         && FAT32_SYM(guid_parse_canonical_ssse3)(ids + i, str))
+        {
+            str += FAT32_GUID_STRING_SIZE;
+            size -= FAT32_GUID_STRING_SIZE;
+            continue;
+        }
+#endif
+
+        /* anything else goes through the tolerant parser. */
+        retval = FAT32_SYM(guid_init_from_string)(ids + i, str);
+        if (STATUS_SUCCESS != retval)
+        {
+            *failed_index = i;
+            goto done;
+        }
+
+        str += FAT32_GUID_STRING_SIZE;
+        size -= FAT32_GUID_STRING_SIZE;
+    }
+
+    *failed_index = count;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_init_from_string_n), retval, ids, count, str, size,
+        failed_index);
+
+    return retval;
+}
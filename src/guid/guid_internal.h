@@ -0,0 +1,180 @@
+/**
+ * \file guid/guid_internal.h
+ *
+ * \brief Internal guid parsing and formatting kernels.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libfat32/guid.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The length of the canonical guid string form,
+ * xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, without its terminator.
+ */
+#define FAT32_GUID_CANONICAL_LENGTH          (FAT32_GUID_STRING_SIZE - 1)
+
+/**
+ * \brief The most entries a \ref guid_map of the given capacity holds.
+ */
+#define FAT32_GUID_MAP_MAX_COUNT(capacity)      ((capacity) - (capacity) / 8)
+
+/**
+ * \brief Get the hash stored in a guid map slot for a key.
+ *
+ * \note The low bit is always set, so that a zero hash marks an empty slot.
+ *
+ * \param key               The key.
+ *
+ * \returns the slot hash of this key.
+ */
+static inline uint64_t guid_map_slot_hash(const FAT32_SYM(guid)* key)
+{
+    return FAT32_SYM(guid_hash)(key) | 1;
+}
+
+/**
+ * \brief Get the home slot of a slot hash, where its probe run starts.
+ *
+ * \param map               The map.
+ * \param hash              The slot hash.
+ *
+ * \returns the index of the home slot.
+ */
+static inline size_t guid_map_home(
+    const FAT32_SYM(guid_map)* map, uint64_t hash)
+{
+    return (size_t)(hash >> 1) & (map->capacity - 1);
+}
+
+/**
+ * \brief Encode a guid in its on-disk form.
+ *
+ * \note On a little-endian host, this compiles to a 16-byte copy.
+ *
+ * \param raw               The 16-byte on-disk guid.
+ * \param id                The guid to encode.
+ */
+static inline void guid_encode_raw(
+    uint8_t raw[FAT32_GUID_BINARY_SIZE], const FAT32_SYM(guid)* id)
+{
+    raw[0] = (uint8_t)(id->data1);
+    raw[1] = (uint8_t)(id->data1 >> 8);
+    raw[2] = (uint8_t)(id->data1 >> 16);
+    raw[3] = (uint8_t)(id->data1 >> 24);
+    raw[4] = (uint8_t)(id->data2);
+    raw[5] = (uint8_t)(id->data2 >> 8);
+    raw[6] = (uint8_t)(id->data3);
+    raw[7] = (uint8_t)(id->data3 >> 8);
+    for (int i = 0; i < 8; ++i)
+    {
+        raw[8 + i] = id->data4[i];
+    }
+}
+
+/**
+ * \brief Run the ChaCha20 block function.
+ *
+ * \note This is the block function of RFC 8439, with a 32-bit block counter
+ * and a 96-bit nonce.
+ *
+ * \param out               The 64-byte keystream block, as sixteen
+ *                          little-endian words.
+ * \param key               The 256-bit key, as eight little-endian words.
+ * \param counter           The block counter.
+ * \param nonce             The 96-bit nonce, as three little-endian words.
+ */
+void FAT32_SYM(guid_chacha20_block)(
+    uint32_t out[16], const uint32_t key[8], uint32_t counter,
+    const uint32_t nonce[3]);
+
+/**
+ * \brief Fill a buffer with cryptographically secure random bytes.
+ *
+ * \note Each thread keeps its own ChaCha20 generator, seeded once from the
+ * operating system and reseeded in a child process after fork. The key is
+ * replaced every time the generator refills, so earlier output can't be
+ * recovered from the generator state.
+ *
+ * \param buffer            The buffer to fill.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_RANDOM_UNAVAILABLE if the generator can't be seeded.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_random_bytes)(void* buffer, size_t size);
+
+/**
+ * \brief Compute the SHA-1 digest of a prefix followed by data.
+ *
+ * \note This is only used to derive name-based (version 5) guids.
+ *
+ * \param digest            The 20-byte digest.
+ * \param prefix            The prefix to hash.
+ * \param prefix_size       The size of the prefix.
+ * \param data              The data to hash after the prefix.
+ * \param size              The size of the data.
+ */
+void FAT32_SYM(guid_sha1)(
+    uint8_t digest[20], const void* prefix, size_t prefix_size,
+    const void* data, size_t size);
+
+#if defined(__x86_64__) && !defined(CBMC)
+/**
+ * \brief Parse a guid in the canonical string form using SSSE3 shuffles.
+ *
+ * \note Only call this on hosts reporting FAT32_CPU_FEATURE_SSSE3, and only
+ * with a string of exactly \ref FAT32_GUID_CANONICAL_LENGTH characters. The
+ * guid is only written on success.
+ *
+ * \param id                The guid to initialize.
+ * \param str               The canonical string.
+ *
+ * \returns true if the string is in canonical form and false otherwise.
+ */
+bool FAT32_SYM(guid_parse_canonical_ssse3)(
+    FAT32_SYM(guid)* id, const char* str);
+
+/**
+ * \brief Find the first record whose raw guid matches an encoded guid, using
+ * SSE2 compares.
+ *
+ * \param base              The on-disk guid of the first record.
+ * \param stride            The distance in bytes between records.
+ * \param count             The number of records.
+ * \param raw               The encoded guid to find.
+ *
+ * \returns the index of the first matching record, or count if no record
+ * matches.
+ */
+size_t FAT32_SYM(guid_find_raw_sse2)(
+    const uint8_t* base, size_t stride, size_t count,
+    const uint8_t raw[FAT32_GUID_BINARY_SIZE]);
+
+/**
+ * \brief Write a guid in the canonical string form using SSSE3 shuffles.
+ *
+ * \note Only call this on hosts reporting FAT32_CPU_FEATURE_SSSE3. The string
+ * must hold at least \ref FAT32_GUID_STRING_SIZE bytes, and is zero
+ * terminated.
+ *
+ * \param str               The string buffer.
+ * \param id                The guid to write.
+ */
+void FAT32_SYM(guid_format_ssse3)(char* str, const FAT32_SYM(guid)* id);
+#endif
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
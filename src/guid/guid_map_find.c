@@ -0,0 +1,69 @@
+/**
+ * \file guid/guid_map_find.c
+ *
+ * \brief Look up a guid in a guid map.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Look up the value of a guid in a guid map.
+ *
+ * \param value             Set to the value of this guid on success.
+ * \param map               The map.
+ * \param key               The guid to find.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_find)(
+    void** value, const FAT32_SYM(guid_map)* map,
+    const FAT32_SYM(guid)* key)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_map_find), value, map, key);
+
+    uint64_t hash = guid_map_slot_hash(key);
+    size_t mask = map->capacity - 1;
+    size_t index = guid_map_home(map, hash);
+
+    /* the key can only be in the probe run starting at its home slot. */
+    for (size_t probes = 0; probes < map->capacity; ++probes)
+    {
+        const FAT32_SYM(guid_map_entry)* entry = map->entries + index;
+
+        if (0 == entry->hash)
+        {
+            break;
+        }
+
+        if (hash == entry->hash && FAT32_SYM(guid_equal)(&entry->key, key))
+        {
+            *value = entry->value;
+            retval = STATUS_SUCCESS;
+            goto done;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    retval = FAT32_ERROR_GUID_MAP_NOT_FOUND;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(FAT32_SYM(guid_map_find), retval);
+
+    return retval;
+}
@@ -0,0 +1,61 @@
+/**
+ * \file guid/guid_map_init.c
+ *
+ * \brief Initialize an empty guid map.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+/**
+ * \brief Initialize an empty guid map over a caller-provided slot array.
+ *
+ * \param map               The map to initialize.
+ * \param entries           The slot array.
+ * \param capacity          The number of slots, which must be a power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_init)(
+    FAT32_SYM(guid_map)* map, FAT32_SYM(guid_map_entry)* entries,
+    size_t capacity)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_map_init), map, entries, capacity);
+
+    /* slots are found by masking the hash. */
+    if (0 == capacity || 0 != (capacity & (capacity - 1)))
+    {
+        retval = FAT32_ERROR_GUID_MAP_BAD_CAPACITY;
+        goto done;
+    }
+
+    /* mark every slot as empty. */
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        entries[i].hash = 0;
+    }
+
+    map->entries = entries;
+    map->capacity = capacity;
+    map->count = 0;
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_map_init), retval, map);
+
+    return retval;
+}
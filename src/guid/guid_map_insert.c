@@ -0,0 +1,79 @@
+/**
+ * \file guid/guid_map_insert.c
+ *
+ * \brief Insert a guid into a guid map.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Insert a guid and its value into a guid map.
+ *
+ * \param map               The map.
+ * \param key               The guid to insert.
+ * \param value             The value to associate with this guid.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_insert)(
+    FAT32_SYM(guid_map)* map, const FAT32_SYM(guid)* key, void* value)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_map_insert), map, key, value);
+
+    uint64_t hash = guid_map_slot_hash(key);
+    size_t mask = map->capacity - 1;
+    size_t index = guid_map_home(map, hash);
+
+    /* walk the probe run to its first empty slot. */
+    for (size_t probes = 0; probes < map->capacity; ++probes)
+    {
+        FAT32_SYM(guid_map_entry)* entry = map->entries + index;
+
+        if (0 == entry->hash)
+        {
+            if (map->count >= FAT32_GUID_MAP_MAX_COUNT(map->capacity))
+            {
+                break;
+            }
+
+            entry->hash = hash;
+            entry->key = *key;
+            entry->value = value;
+            ++map->count;
+
+            retval = STATUS_SUCCESS;
+            goto done;
+        }
+
+        if (hash == entry->hash && FAT32_SYM(guid_equal)(&entry->key, key))
+        {
+            retval = FAT32_ERROR_GUID_MAP_DUPLICATE;
+            goto done;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    retval = FAT32_ERROR_GUID_MAP_FULL;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_map_insert), retval, map);
+
+    return retval;
+}
@@ -0,0 +1,123 @@
+/**
+ * \file guid/guid_map_remove.c
+ *
+ * \brief Remove a guid from a guid map.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+
+#include "guid_internal.h"
+
+/* forward decls. */
+static bool can_fill(size_t hole, size_t home, size_t index);
+
+/**
+ * \brief Remove a guid from a guid map.
+ *
+ * \param map               The map.
+ * \param key               The guid to remove.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_map_remove)(
+    FAT32_SYM(guid_map)* map, const FAT32_SYM(guid)* key)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(FAT32_SYM(guid_map_remove), map, key);
+
+    uint64_t hash = guid_map_slot_hash(key);
+    size_t mask = map->capacity - 1;
+    size_t hole = guid_map_home(map, hash);
+    size_t probes;
+
+    /* find the key in its probe run. */
+    for (probes = 0; probes < map->capacity; ++probes)
+    {
+        const FAT32_SYM(guid_map_entry)* entry = map->entries + hole;
+
+        if (0 == entry->hash)
+        {
+            probes = map->capacity;
+            break;
+        }
+
+        if (hash == entry->hash && FAT32_SYM(guid_equal)(&entry->key, key))
+        {
+            break;
+        }
+
+        hole = (hole + 1) & mask;
+    }
+
+    if (probes == map->capacity)
+    {
+        retval = FAT32_ERROR_GUID_MAP_NOT_FOUND;
+        goto done;
+    }
+
+    /* shift later entries of the run back into the hole, so that every entry
+     * stays reachable from its home slot. */
+    size_t index = hole;
+    for (probes = 1; probes < map->capacity; ++probes)
+    {
+        index = (index + 1) & mask;
+
+        FAT32_SYM(guid_map_entry)* entry = map->entries + index;
+        if (0 == entry->hash)
+        {
+            break;
+        }
+
+        if (can_fill(hole, guid_map_home(map, entry->hash), index))
+        {
+            map->entries[hole] = *entry;
+            hole = index;
+        }
+    }
+
+    map->entries[hole].hash = 0;
+    --map->count;
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_map_remove), retval, map);
+
+    return retval;
+}
+
+/**
+ * \brief Returns true if an entry can move back into a hole.
+ *
+ * \note This is the case when the entry's home slot doesn't lie cyclically
+ * after the hole and at or before the entry's current slot.
+ *
+ * \param hole              The index of the hole.
+ * \param home              The home slot of the entry.
+ * \param index             The current slot of the entry.
+ *
+ * \returns true if the entry can fill the hole and false otherwise.
+ */
+static bool can_fill(size_t hole, size_t home, size_t index)
+{
+    if (hole <= index)
+    {
+        return home <= hole || home > index;
+    }
+    else
+    {
+        return home <= hole && home > index;
+    }
+}
@@ -0,0 +1,41 @@
+/**
+ * \file guid/guid_match_raw.c
+ *
+ * \brief Match a guid in its on-disk form.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <string.h>
+
+#include "guid_internal.h"
+
+/**
+ * \brief Returns true if a guid in its on-disk form matches a guid.
+ *
+ * \param data              The 16-byte on-disk guid.
+ * \param target            The guid to match.
+ *
+ * \returns true if the raw guid matches the target and false otherwise.
+ */
+bool FAT32_SYM(guid_match_raw)(
+    const void* data, const FAT32_SYM(guid)* target)
+{
+    bool retval;
+    uint8_t raw[FAT32_GUID_BINARY_SIZE];
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_match_raw), data, target);
+
+    guid_encode_raw(raw, target);
+    retval = 0 == memcmp(data, raw, sizeof(raw));
+
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_match_raw), retval, data, target);
+
+    return retval;
+}
@@ -0,0 +1,134 @@
+/**
+ * \file guid/guid_parse_canonical_ssse3.c
+ *
+ * \brief Parse a canonical guid string using SSSE3 shuffles.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "guid_internal.h"
+
+#if defined(__x86_64__) && !defined(CBMC)
+
+#include <immintrin.h>
+
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+
+/* the guid is stored with a single 16-byte store. */
+_Static_assert(
+    FAT32_GUID_BINARY_SIZE == sizeof(FAT32_SYM(guid)),
+    "the guid must have no padding");
+
+/*
+ * Gather the 32 hex digits out of the three loads of the canonical form. The
+ * loads cover bytes 0-15, 16-31, and 20-35 of the string. Each digit comes
+ * from exactly one load; 0x80 zeroes a byte.
+ */
+static const int8_t gather_lo_a[16] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, -128, -128 };
+static const int8_t gather_lo_b[16] = {
+    -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, 0, 1 };
+static const int8_t gather_hi_b[16] = {
+    3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, -128, -128, -128, -128 };
+static const int8_t gather_hi_c[16] = {
+    -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, 12, 13, 14, 15 };
+
+/*
+ * Reorder the sixteen bytes in string order into the in-memory guid layout,
+ * swapping data1, data2, and data3 to host (little-endian) order.
+ */
+static const int8_t guid_order[16] = {
+    3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+/**
+ * \brief Convert sixteen hex digits to nibbles.
+ *
+ * \param digits            The hex digits.
+ * \param valid             Cleared in each byte that isn't a hex digit.
+ *
+ * \returns the nibble value of each digit.
+ */
+static inline SSSE3_TARGET __m128i hex_nibbles(__m128i digits, __m128i* valid)
+{
+    __m128i dec = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+    __m128i alpha =
+        _mm_sub_epi8(
+            _mm_or_si128(digits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+    /* unsigned range checks: 0-9 for decimal digits, 0-5 for a-f and A-F. */
+    __m128i is_dec = _mm_cmpeq_epi8(_mm_min_epu8(dec, _mm_set1_epi8(9)), dec);
+    __m128i is_alpha =
+        _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+
+    *valid = _mm_and_si128(*valid, _mm_or_si128(is_dec, is_alpha));
+
+    return
+        _mm_or_si128(
+            _mm_and_si128(dec, is_dec),
+            _mm_and_si128(
+                _mm_add_epi8(alpha, _mm_set1_epi8(10)), is_alpha));
+}
+
+/**
+ * \brief Parse a guid in the canonical string form using SSSE3 shuffles.
+ *
+ * \param id                The guid to initialize.
+ * \param str               The canonical string.
+ *
+ * \returns true if the string is in canonical form and false otherwise.
+ */
+SSSE3_TARGET
+bool FAT32_SYM(guid_parse_canonical_ssse3)(
+    FAT32_SYM(guid)* id, const char* str)
+{
+    __m128i a = _mm_loadu_si128((const __m128i*)(str + 0));
+    __m128i b = _mm_loadu_si128((const __m128i*)(str + 16));
+    __m128i c = _mm_loadu_si128((const __m128i*)(str + 20));
+    __m128i valid = _mm_set1_epi8(-1);
+    __m128i lo, hi, bytes;
+
+    /* the separators must be at offsets 8, 13, 18, and 23. */
+    int dash_a = _mm_movemask_epi8(_mm_cmpeq_epi8(a, _mm_set1_epi8('-')));
+    int dash_b = _mm_movemask_epi8(_mm_cmpeq_epi8(b, _mm_set1_epi8('-')));
+    if (
+        (0x2100 != (dash_a & 0x2100))
+     || (0x0084 != (dash_b & 0x0084)))
+    {
+        return false;
+    }
+
+    /* gather the digits in string order. */
+    lo =
+        _mm_or_si128(
+            _mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i*)gather_lo_a)),
+            _mm_shuffle_epi8(b, _mm_loadu_si128((const __m128i*)gather_lo_b)));
+    hi =
+        _mm_or_si128(
+            _mm_shuffle_epi8(b, _mm_loadu_si128((const __m128i*)gather_hi_b)),
+            _mm_shuffle_epi8(c, _mm_loadu_si128((const __m128i*)gather_hi_c)));
+
+    /* convert and validate every digit. */
+    lo = hex_nibbles(lo, &valid);
+    hi = hex_nibbles(hi, &valid);
+    if (0xffff != _mm_movemask_epi8(valid))
+    {
+        return false;
+    }
+
+    /* combine each pair of nibbles into a byte. */
+    lo = _mm_maddubs_epi16(lo, _mm_set1_epi16(0x0110));
+    hi = _mm_maddubs_epi16(hi, _mm_set1_epi16(0x0110));
+    bytes = _mm_packus_epi16(lo, hi);
+
+    /* store the fields in host order. */
+    bytes = _mm_shuffle_epi8(
+        bytes, _mm_loadu_si128((const __m128i*)guid_order));
+    _mm_storeu_si128((__m128i*)id, bytes);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ * \file guid/guid_random_bytes.c
+ *
+ * \brief Per-thread cryptographically secure random bytes.
+ *
+ * \note The generator follows the fast key erasure design: each refill runs
+ * ChaCha20 over several blocks, the first 32 bytes replace the key, and the
+ * rest are handed out and erased as they are used.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <errno.h>
+#include <libfat32/status.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/random.h>
+
+#include "guid_internal.h"
+
+/* The number of ChaCha20 blocks generated per refill. */
+#define RNG_BLOCKS                                                          8
+#define RNG_BLOCK_SIZE                                                     64
+#define RNG_KEY_SIZE                                                       32
+#define RNG_BUFFER_SIZE                           (RNG_BLOCKS * RNG_BLOCK_SIZE)
+
+/**
+ * \brief The generator state of a thread.
+ */
+typedef struct rng_state rng_state;
+
+struct rng_state
+{
+    /* the fork generation this state was seeded in, or 0 if unseeded. */
+    uint64_t generation;
+    uint32_t key[RNG_KEY_SIZE / 4];
+    uint8_t buffer[RNG_BUFFER_SIZE];
+    /* the number of unused bytes at the end of the buffer. */
+    size_t available;
+};
+
+static _Thread_local rng_state rng;
+
+/* bumped in each child process, so that inherited states are reseeded. */
+static _Atomic uint64_t fork_generation = 1;
+static pthread_once_t atfork_once = PTHREAD_ONCE_INIT;
+static int atfork_status;
+
+/* forward decls. */
+static void register_atfork(void);
+static void atfork_child(void);
+static int seed(uint64_t generation);
+static void refill(void);
+static uint32_t load_le32(const uint8_t* p);
+static void store_le32(uint8_t* p, uint32_t value);
+
+/**
+ * \brief Fill a buffer with cryptographically secure random bytes.
+ *
+ * \param buffer            The buffer to fill.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_RANDOM_UNAVAILABLE if the generator can't be seeded.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_random_bytes)(void* buffer, size_t size)
+{
+    int retval;
+    uint8_t* out = (uint8_t*)buffer;
+
+    /* register the fork handler once per process. */
+    pthread_once(&atfork_once, &register_atfork);
+    if (0 != atfork_status)
+    {
+        retval = FAT32_ERROR_GUID_RANDOM_UNAVAILABLE;
+        goto done;
+    }
+
+    /* seed on first use in this thread, and again after a fork. */
+    uint64_t generation =
+        atomic_load_explicit(&fork_generation, memory_order_relaxed);
+    if (rng.generation != generation)
+    {
+        retval = seed(generation);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    while (size > 0)
+    {
+        if (0 == rng.available)
+        {
+            refill();
+        }
+
+        /* hand out the unused bytes, erasing them from the state. */
+        size_t count = size < rng.available ? size : rng.available;
+        uint8_t* src = rng.buffer + RNG_BUFFER_SIZE - rng.available;
+        memcpy(out, src, count);
+        memset(src, 0, count);
+
+        rng.available -= count;
+        out += count;
+        size -= count;
+    }
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Register the fork handler that invalidates inherited states.
+ */
+static void register_atfork(void)
+{
+    atfork_status = pthread_atfork(NULL, NULL, &atfork_child);
+}
+
+/**
+ * \brief Invalidate the generator states copied into a child process.
+ */
+static void atfork_child(void)
+{
+    atomic_fetch_add_explicit(&fork_generation, 1, memory_order_relaxed);
+}
+
+/**
+ * \brief Seed this thread's generator from the operating system.
+ *
+ * \param generation        The current fork generation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - FAT32_ERROR_GUID_RANDOM_UNAVAILABLE if the seed can't be read.
+ */
+static int seed(uint64_t generation)
+{
+    int retval;
+    uint8_t key[RNG_KEY_SIZE];
+    size_t offset = 0;
+
+    /* this only blocks until the kernel pool is first initialized. */
+    while (offset < sizeof(key))
+    {
+        ssize_t count = getrandom(key + offset, sizeof(key) - offset, 0);
+        if (count < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            retval = FAT32_ERROR_GUID_RANDOM_UNAVAILABLE;
+            goto done;
+        }
+
+        offset += (size_t)count;
+    }
+
+    for (int i = 0; i < RNG_KEY_SIZE / 4; ++i)
+    {
+        rng.key[i] = load_le32(key + 4 * i);
+    }
+
+    /* discard any output generated under the previous key. */
+    memset(rng.buffer, 0, sizeof(rng.buffer));
+    rng.available = 0;
+    rng.generation = generation;
+
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    explicit_bzero(key, sizeof(key));
+
+    return retval;
+}
+
+/**
+ * \brief Refill the buffer and replace the key.
+ */
+static void refill(void)
+{
+    static const uint32_t nonce[3] = { 0, 0, 0 };
+    uint32_t block[RNG_BLOCK_SIZE / 4];
+
+    /* the key is only used for one refill, so the counter starts at zero. */
+    for (uint32_t b = 0; b < RNG_BLOCKS; ++b)
+    {
+        FAT32_SYM(guid_chacha20_block)(block, rng.key, b, nonce);
+
+        for (int i = 0; i < RNG_BLOCK_SIZE / 4; ++i)
+        {
+            store_le32(rng.buffer + b * RNG_BLOCK_SIZE + 4 * i, block[i]);
+        }
+    }
+
+    /* the first bytes become the next key, and are never handed out. */
+    for (int i = 0; i < RNG_KEY_SIZE / 4; ++i)
+    {
+        rng.key[i] = load_le32(rng.buffer + 4 * i);
+    }
+
+    memset(rng.buffer, 0, RNG_KEY_SIZE);
+    rng.available = RNG_BUFFER_SIZE - RNG_KEY_SIZE;
+
+    explicit_bzero(block, sizeof(block));
+}
+
+/**
+ * \brief Load a little-endian 32-bit word.
+ *
+ * \param p                 The four bytes to load.
+ *
+ * \returns the word.
+ */
+static uint32_t load_le32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0])       | ((uint32_t)p[1] <<  8)
+      | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * \brief Store a little-endian 32-bit word.
+ *
+ * \param p                 The four bytes to store.
+ * \param value             The word.
+ */
+static void store_le32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)(value);
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
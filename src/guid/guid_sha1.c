@@ -0,0 +1,192 @@
+/**
+ * \file guid/guid_sha1.c
+ *
+ * \brief SHA-1, as described in FIPS 180-4, for name-based guids.
+ *
+ * \note SHA-1 is only used here because RFC 9562 specifies it for version 5
+ * guids. It is not used for any security property.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "guid_internal.h"
+
+#define SHA1_BLOCK_SIZE                                                    64
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/**
+ * \brief The running state of a digest.
+ */
+typedef struct sha1_state sha1_state;
+
+struct sha1_state
+{
+    uint32_t h[5];
+    uint64_t length;
+    uint8_t block[SHA1_BLOCK_SIZE];
+    size_t used;
+};
+
+/* forward decls. */
+static void absorb(sha1_state* state, const uint8_t* data, size_t size);
+static void compress(uint32_t h[5], const uint8_t* block);
+
+/**
+ * \brief Compute the SHA-1 digest of a prefix followed by data.
+ *
+ * \param digest            The 20-byte digest.
+ * \param prefix            The prefix to hash.
+ * \param prefix_size       The size of the prefix.
+ * \param data              The data to hash after the prefix.
+ * \param size              The size of the data.
+ */
+void FAT32_SYM(guid_sha1)(
+    uint8_t digest[20], const void* prefix, size_t prefix_size,
+    const void* data, size_t size)
+{
+    static const uint8_t pad = 0x80;
+    static const uint8_t zeroes[SHA1_BLOCK_SIZE] = { 0 };
+    sha1_state state = {
+        { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 },
+        0, { 0 }, 0 };
+    uint8_t length[8];
+
+    absorb(&state, (const uint8_t*)prefix, prefix_size);
+    absorb(&state, (const uint8_t*)data, size);
+
+    /* the message length in bits, big-endian, taken before padding. */
+    uint64_t bits = state.length * 8;
+    for (int i = 0; i < 8; ++i)
+    {
+        length[i] = (uint8_t)(bits >> (56 - 8 * i));
+    }
+
+    /* pad with a one bit and zeroes until the length ends a block. */
+    absorb(&state, &pad, 1);
+    absorb(
+        &state, zeroes,
+        (SHA1_BLOCK_SIZE * 2 - 8 - state.used) % SHA1_BLOCK_SIZE);
+    absorb(&state, length, sizeof(length));
+
+    for (int i = 0; i < 5; ++i)
+    {
+        digest[4 * i + 0] = (uint8_t)(state.h[i] >> 24);
+        digest[4 * i + 1] = (uint8_t)(state.h[i] >> 16);
+        digest[4 * i + 2] = (uint8_t)(state.h[i] >> 8);
+        digest[4 * i + 3] = (uint8_t)(state.h[i]);
+    }
+}
+
+/**
+ * \brief Add bytes to a digest, compressing each block as it fills.
+ *
+ * \param state             The digest state.
+ * \param data              The bytes to add.
+ * \param size              The number of bytes to add.
+ */
+static void absorb(sha1_state* state, const uint8_t* data, size_t size)
+{
+    state->length += size;
+
+    /* top up a partial block. */
+    if (state->used > 0)
+    {
+        size_t count = SHA1_BLOCK_SIZE - state->used;
+        if (count > size)
+        {
+            count = size;
+        }
+
+        memcpy(state->block + state->used, data, count);
+        state->used += count;
+        data += count;
+        size -= count;
+
+        if (SHA1_BLOCK_SIZE != state->used)
+        {
+            return;
+        }
+
+        compress(state->h, state->block);
+        state->used = 0;
+    }
+
+    /* compress whole blocks in place. */
+    while (size >= SHA1_BLOCK_SIZE)
+    {
+        compress(state->h, data);
+        data += SHA1_BLOCK_SIZE;
+        size -= SHA1_BLOCK_SIZE;
+    }
+
+    /* keep the rest for the next call. */
+    memcpy(state->block, data, size);
+    state->used = size;
+}
+
+/**
+ * \brief Run the SHA-1 compression function over one block.
+ *
+ * \param h                 The chaining value, updated in place.
+ * \param block             The 64-byte block.
+ */
+static void compress(uint32_t h[5], const uint8_t* block)
+{
+    uint32_t w[80];
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+
+    for (int t = 0; t < 16; ++t)
+    {
+        w[t] =
+            ((uint32_t)block[4 * t] << 24) | ((uint32_t)block[4 * t + 1] << 16)
+          | ((uint32_t)block[4 * t + 2] << 8) | ((uint32_t)block[4 * t + 3]);
+    }
+
+    for (int t = 16; t < 80; ++t)
+    {
+        w[t] = ROTL32(w[t - 3] ^ w[t - 8] ^ w[t - 14] ^ w[t - 16], 1);
+    }
+
+    for (int t = 0; t < 80; ++t)
+    {
+        uint32_t f, k;
+
+        if (t < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5a827999;
+        }
+        else if (t < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1;
+        }
+        else if (t < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdc;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6;
+        }
+
+        uint32_t temp = ROTL32(a, 5) + f + e + k + w[t];
+        e = d;
+        d = c;
+        c = ROTL32(b, 30);
+        b = a;
+        a = temp;
+    }
+
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+}
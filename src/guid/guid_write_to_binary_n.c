@@ -0,0 +1,78 @@
+/**
+ * \file guid/guid_write_to_binary_n.c
+ *
+ * \brief Write an array of guids to a binary buffer.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * \brief Write an array of guids to a binary buffer.
+ *
+ * \param buffer            The binary buffer.
+ * \param size              The size of the binary buffer, which must be exactly
+ *                          count guids.
+ * \param ids               The guids to write.
+ * \param count             The number of guids.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          written, or to count on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_write_to_binary_n)(
+    void* buffer, size_t size, const FAT32_SYM(guid)* ids, size_t count,
+    size_t* failed_index)
+{
+    int retval;
+    uint8_t* bbuf = (uint8_t*)buffer;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_write_to_binary_n), buffer, size, ids, count,
+        failed_index);
+
+    /* make sure the buffer holds exactly count guids. */
+    if (
+        count > SIZE_MAX / FAT32_GUID_BINARY_SIZE
+     || size != count * FAT32_GUID_BINARY_SIZE)
+    {
+        *failed_index = 0;
+        retval = FAT32_ERROR_GUID_DATA_INVALID_SIZE;
+        goto done;
+    }
+
+    /* encode each little-endian field without branching. */
+    for (size_t i = 0; i < count; ++i, bbuf += FAT32_GUID_BINARY_SIZE)
+    {
+        bbuf[0] = (uint8_t)(ids[i].data1);
+        bbuf[1] = (uint8_t)(ids[i].data1 >> 8);
+        bbuf[2] = (uint8_t)(ids[i].data1 >> 16);
+        bbuf[3] = (uint8_t)(ids[i].data1 >> 24);
+        bbuf[4] = (uint8_t)(ids[i].data2);
+        bbuf[5] = (uint8_t)(ids[i].data2 >> 8);
+        bbuf[6] = (uint8_t)(ids[i].data3);
+        bbuf[7] = (uint8_t)(ids[i].data3 >> 8);
+        memcpy(bbuf + 8, ids[i].data4, sizeof(ids[i].data4));
+    }
+
+    *failed_index = count;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_write_to_binary_n), retval, buffer, size, ids, count,
+        failed_index);
+
+    return retval;
+}
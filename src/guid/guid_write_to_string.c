@@ -9,10 +9,33 @@
 
 #include <libfat32/guid.h>
 #include <libfat32/status.h>
+#include <string.h>
+
+#include "../cpu/cpu_internal.h"
+#include "guid_internal.h"
 
 /* forward decls. */
 static void write_hex_chars(char* str, uint64_t value, size_t count);
-static char hex_nibble(unsigned int value);
+
+/* The two lowercase hex characters of each byte value, in byte order, plus the
+ * terminating NUL of the literal. */
+static const char hex_table[513] =
+    "000102030405060708090a0b0c0d0e0f"
+    "101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f"
+    "303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f"
+    "505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f"
+    "707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f"
+    "909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeaf"
+    "b0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+    "d0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeef"
+    "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
 
 /**
  * \brief Write the guid representation in the given string buffer.
@@ -42,6 +65,16 @@ FAT32_SYM(guid_write_to_string)(
         goto done;
     }
 
+#if defined(__x86_64__) && !defined(CBMC)
+    /* format all 36 characters in vector registers. */
+    if (FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3)
+    {
+        FAT32_SYM(guid_format_ssse3)(str, id);
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+#endif
+
     /* convert to the string representation. */
     write_hex_chars(str,      id->data1, 8);
     write_hex_chars(str +  9, id->data2, 4);
@@ -72,40 +105,21 @@ done:
 }
 
 /**
- * \brief Write hex characters to a string.
+ * \brief Write hex characters to a string, a byte at a time.
  *
  * \note This method does not zero terminate the string.
  *
  * \param str           The output string to which the characters are written.
  * \param value         The value to write as a hex string.
- * \param count         The number of characters to write.
+ * \param count         The number of characters to write, which must be even.
  */
 static void write_hex_chars(char* str, uint64_t value, size_t count)
 {
-    for (size_t i = 0; i < count; ++i)
-    {
-        str[count - i - 1] = hex_nibble(value & 0x0F);
-        value >>= 4;
-    }
-}
+    MODEL_ASSERT(0 == count % 2);
 
-/**
- * \brief Return the hex nibble of a given value.
- *
- * \param value         The value to convert.
- *
- * \returns a hex character representation of this nibble.
- */
-static char hex_nibble(unsigned int value)
-{
-    MODEL_ASSERT(value <= 0xF);
-
-    if (value <= 9)
-    {
-        return value + '0';
-    }
-    else
+    for (size_t i = 2; i <= count; i += 2)
     {
-        return value - 10 + 'a';
+        memcpy(str + count - i, hex_table + 2 * (value & 0xFF), 2);
+        value >>= 8;
     }
 }
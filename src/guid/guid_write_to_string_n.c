@@ -0,0 +1,95 @@
+/**
+ * \file guid/guid_write_to_string_n.c
+ *
+ * \brief Write an array of guids to an array of strings.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <stdint.h>
+
+#include "../cpu/cpu_internal.h"
+#include "guid_internal.h"
+
+/**
+ * \brief Write an array of guids to an array of strings.
+ *
+ * \param str               The string buffer.
+ * \param size              The size of the string buffer, which must hold at
+ *                          least count strings.
+ * \param ids               The guids to write.
+ * \param count             The number of guids.
+ * \param failed_index      Set to the index of the first guid that could not be
+ *                          written, or to count on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error on failure.
+ */
+int FN_DECL_MUST_CHECK
+FAT32_SYM(guid_write_to_string_n)(
+    char* str, size_t size, const FAT32_SYM(guid)* ids, size_t count,
+    size_t* failed_index)
+{
+    int retval;
+
+    /* check preconditions. */
+    MODEL_CONTRACT_CHECK_PRECONDITIONS(
+        FAT32_SYM(guid_write_to_string_n), str, size, ids, count,
+        failed_index);
+
+    /* verify that this buffer can hold every guid representation. */
+    if (
+        count > SIZE_MAX / FAT32_GUID_STRING_SIZE
+     || size < count * FAT32_GUID_STRING_SIZE)
+    {
+        *failed_index = 0;
+        retval = FAT32_ERROR_GUID_STRING_BAD;
+        goto done;
+    }
+
+#if defined(__x86_64__) && !defined(CBMC)
+    /* select the formatter once for the whole array. */
+    if (FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            FAT32_SYM(guid_format_ssse3)(
+                str + i * FAT32_GUID_STRING_SIZE, ids + i);
+        }
+
+        *failed_index = count;
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+#endif
+
+    /* every slot has room, so each write succeeds. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        retval =
+            FAT32_SYM(guid_write_to_string)(
+                str + i * FAT32_GUID_STRING_SIZE, FAT32_GUID_STRING_SIZE,
+                ids + i);
+        if (STATUS_SUCCESS != retval)
+        {
+            *failed_index = i;
+            goto done;
+        }
+    }
+
+    *failed_index = count;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    /* check postconditions. */
+    MODEL_CONTRACT_CHECK_POSTCONDITIONS(
+        FAT32_SYM(guid_write_to_string_n), retval, str, size, ids, count,
+        failed_index);
+
+    return retval;
+}
@@ -0,0 +1,102 @@
+/**
+ * \file test/crc/test_crc32_combine.cpp
+ *
+ * \brief Unit tests for combining CRC-32 values.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../../src/crc/crc32_internal.h"
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_combine);
+
+/**
+ * Combining the CRC-32 values of two halves of the Ross N. Williams test vector
+ * produces the expected CRC-32.
+ */
+TEST(crc32_combine_base_test)
+{
+    const char* input = "123456789";
+
+    for (size_t split = 0; split <= 9; ++split)
+    {
+        uint32_t crc_a = crc32(input, split);
+        uint32_t crc_b = crc32(input + split, 9 - split);
+
+        TEST_EXPECT(0xcbf43926 == crc32_combine(crc_a, crc_b, 9 - split));
+    }
+}
+
+/**
+ * Combining with an empty second section yields the first CRC-32.
+ */
+TEST(crc32_combine_empty)
+{
+    TEST_EXPECT(0xcbf43926 == crc32_combine(0xcbf43926, crc32("", 0), 0));
+}
+
+/**
+ * Combining the chunks of a buffer in order yields the CRC-32 of the buffer.
+ */
+TEST(crc32_combine_chunks)
+{
+    uint8_t buffer[16384];
+
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        buffer[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+
+    for (size_t chunk = 1; chunk <= sizeof(buffer); chunk = chunk * 3 + 1)
+    {
+        uint32_t crc = crc32("", 0);
+
+        for (size_t offset = 0; offset < sizeof(buffer); offset += chunk)
+        {
+            size_t size = sizeof(buffer) - offset;
+            if (size > chunk)
+            {
+                size = chunk;
+            }
+
+            crc = crc32_combine(crc, crc32(buffer + offset, size), size);
+        }
+
+        TEST_EXPECT(crc32(buffer, sizeof(buffer)) == crc);
+    }
+}
+
+/**
+ * The zero operator matches running a register through zero bytes, including
+ * for lengths beyond the period of the operator table.
+ */
+TEST(crc32_x8nmodp_matches_zero_bytes)
+{
+    static uint8_t zeroes[70000];
+    const uint64_t lengths[] = { 0, 1, 3, 64, 511, 4096, 65537, 69999 };
+
+    memset(zeroes, 0, sizeof(zeroes));
+
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+    {
+        uint32_t reg = 0x89abcdef;
+
+        TEST_EXPECT(
+            FAT32_SYM(crc32_kernel_bytewise)(reg, zeroes, lengths[i])
+                == FAT32_SYM(crc32_multmodp)(
+                        FAT32_SYM(crc32_x8nmodp)(lengths[i]), reg));
+    }
+
+    /* x^(2^32) = x, so the table wraps; 2^32 zero bytes is x^(2^35). */
+    TEST_EXPECT(
+        FAT32_SYM(crc32_x2n_constants)[3]
+            == FAT32_SYM(crc32_x8nmodp)(UINT64_C(1) << 32));
+}
@@ -0,0 +1,50 @@
+/**
+ * \file test/crc/test_crc32_constexpr.cpp
+ *
+ * \brief Unit tests for the compile-time CRC-32.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/fat32.hpp>
+#include <minunit/minunit.h>
+
+using namespace fat32::literals;
+
+TEST_SUITE(crc32_constexpr);
+
+/* the Ross N. Williams test vector is checked at compile time. */
+static_assert(0xcbf43926 == "123456789"_crc32);
+static_assert(0xcbf43926 == fat32::crc32(std::string_view("123456789")));
+static_assert(0x00000000 == ""_crc32);
+static_assert(
+    0xcbf43926
+        == fat32::crc32(
+                std::array<std::uint8_t, 9>{
+                    '1', '2', '3', '4', '5', '6', '7', '8', '9' }));
+
+/**
+ * The compile-time table matches the generated constants.
+ */
+TEST(crc32_constexpr_table)
+{
+    for (std::size_t i = 0; i < 256; ++i)
+    {
+        TEST_EXPECT(
+            FAT32_SYM(crc32_constants)[i] == fat32::detail::crc32_table[i]);
+    }
+}
+
+/**
+ * The compile-time CRC-32 matches the library CRC-32 when evaluated at run
+ * time.
+ */
+TEST(crc32_constexpr_runtime)
+{
+    constexpr std::uint32_t expected = "The quick brown fox"_crc32;
+    std::string_view str("The quick brown fox");
+
+    TEST_EXPECT(expected == fat32::crc32(str));
+    TEST_EXPECT(expected == FAT32_SYM(crc32)(str.data(), str.size()));
+}
@@ -0,0 +1,117 @@
+/**
+ * \file test/crc/test_crc32_copy.cpp
+ *
+ * \brief Unit tests for the fused copy and CRC-32.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/crc/crc32_internal.h"
+#include "../test_pattern.h"
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_copy);
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x2468ace0
+
+/**
+ * \brief Check a copy kernel against memcpy and the CRC-32 kernel for every
+ * size through several blocks, at every relative alignment.
+ */
+static bool copy_kernel_matches(FAT32_SYM(crc32_copy_kernel_fn) kernel)
+{
+    uint8_t src[16 + 400];
+    uint8_t dst[16 + 400];
+
+    fill_pattern(src, sizeof(src), PATTERN_SEED);
+
+    for (size_t src_offset = 0; src_offset < 16; src_offset += 3)
+    {
+        for (size_t dst_offset = 0; dst_offset < 16; ++dst_offset)
+        {
+            for (size_t size = 0; size <= 400; ++size)
+            {
+                memset(dst, 0, sizeof(dst));
+
+                uint32_t crc =
+                    kernel(
+                        0xffffffff, dst + dst_offset, src + src_offset, size);
+
+                if (
+                    crc
+                        != FAT32_SYM(crc32_kernel_bytewise)(
+                                0xffffffff, src + src_offset, size)
+                 || 0 != memcmp(dst + dst_offset, src + src_offset, size))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * The fused copy produces the Ross N. Williams test vector and copies it.
+ */
+TEST(crc32_copy_base_test)
+{
+    char dst[9];
+
+    TEST_EXPECT(0xcbf43926 == crc32_copy(dst, "123456789", 9));
+    TEST_EXPECT(0 == memcmp(dst, "123456789", 9));
+}
+
+/**
+ * The chunked copy kernel matches memcpy and the CRC-32 kernel.
+ */
+TEST(crc32_copy_kernel_chunked_matches)
+{
+    TEST_EXPECT(copy_kernel_matches(&FAT32_SYM(crc32_copy_kernel_chunked)));
+}
+
+#if defined(__x86_64__)
+/**
+ * The PCLMUL copy kernel matches memcpy and the CRC-32 kernel.
+ */
+TEST(crc32_copy_kernel_pclmul_matches)
+{
+    /* skip this test on hosts without carry-less multiply. */
+    if (!(FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_PCLMUL))
+    {
+        return;
+    }
+
+    TEST_EXPECT(copy_kernel_matches(&FAT32_SYM(crc32_copy_kernel_pclmul)));
+}
+#endif
+
+/**
+ * Copies large enough to use non-temporal stores match memcpy and crc32.
+ */
+TEST(crc32_copy_large)
+{
+    const size_t size = 2 * 1024 * 1024 + 37;
+    uint8_t* src = (uint8_t*)malloc(size + 1);
+    uint8_t* dst = (uint8_t*)malloc(size + 1);
+    TEST_ASSERT(NULL != src && NULL != dst);
+
+    fill_pattern(src, size + 1, PATTERN_SEED);
+
+    TEST_EXPECT(crc32(src + 1, size) == crc32_copy(dst + 1, src + 1, size));
+    TEST_EXPECT(0 == memcmp(dst + 1, src + 1, size));
+
+    free(src);
+    free(dst);
+}
@@ -0,0 +1,162 @@
+/**
+ * \file test/crc/test_crc32_kernels.cpp
+ *
+ * \brief Unit tests for the internal CRC-32 kernels.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/crc/crc32_internal.h"
+#include "../test_pattern.h"
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_kernels);
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x12345678
+
+/**
+ * The slicing-by-16 kernel produces the Ross N. Williams test vector.
+ */
+TEST(crc32_kernel_slice16_base_test)
+{
+    const uint32_t EXPECTED_RESULT = 0xcbf43926;
+    const char* input = "123456789";
+
+    TEST_ASSERT(
+        EXPECTED_RESULT
+            == (FAT32_SYM(crc32_kernel_slice16)(0xffffffff, input, 9)
+                    ^ 0xffffffff));
+}
+
+/**
+ * The slicing-by-16 kernel matches the bytewise kernel for every size and
+ * alignment through several blocks.
+ */
+TEST(crc32_kernel_slice16_matches_bytewise)
+{
+    uint8_t buffer[16 + 300];
+
+    fill_pattern(buffer, sizeof(buffer), PATTERN_SEED);
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        for (size_t size = 0; size <= 300; ++size)
+        {
+            TEST_EXPECT(
+                FAT32_SYM(crc32_kernel_bytewise)(
+                    0xffffffff, buffer + offset, size)
+                    == FAT32_SYM(crc32_kernel_slice16)(
+                            0xffffffff, buffer + offset, size));
+        }
+    }
+}
+
+/**
+ * The first slicing table is the byte table.
+ */
+TEST(crc32_slice_constants_table_zero)
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        TEST_EXPECT(
+            FAT32_SYM(crc32_constants)[i]
+                == FAT32_SYM(crc32_slice_constants)[0][i]);
+    }
+}
+
+#if defined(__x86_64__)
+/**
+ * The PCLMUL kernel matches the bytewise kernel for every size and alignment
+ * through several folding blocks.
+ */
+TEST(crc32_kernel_pclmul_matches_bytewise)
+{
+    uint8_t buffer[16 + 600];
+
+    /* skip this test on hosts without carry-less multiply. */
+    if (!(FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_PCLMUL))
+    {
+        return;
+    }
+
+    fill_pattern(buffer, sizeof(buffer), PATTERN_SEED);
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        for (size_t size = 0; size <= 600; ++size)
+        {
+            TEST_EXPECT(
+                FAT32_SYM(crc32_kernel_bytewise)(
+                    0xffffffff, buffer + offset, size)
+                    == FAT32_SYM(crc32_kernel_pclmul)(
+                            0xffffffff, buffer + offset, size));
+        }
+    }
+}
+
+/**
+ * The VPCLMUL kernel matches the bytewise kernel across the threshold, for
+ * every tail size and several alignments.
+ */
+TEST(crc32_kernel_vpclmul_matches_bytewise)
+{
+    const uint32_t wide_features =
+        FAT32_CPU_FEATURE_PCLMUL | FAT32_CPU_FEATURE_AVX512
+      | FAT32_CPU_FEATURE_VPCLMUL;
+    const size_t first = FAT32_CRC32_VPCLMUL_THRESHOLD - 16;
+    const size_t last = FAT32_CRC32_VPCLMUL_THRESHOLD + 600;
+    static uint8_t buffer[64 + FAT32_CRC32_VPCLMUL_THRESHOLD + 600];
+
+    /* skip this test on hosts without 512-bit carry-less multiply. */
+    if (wide_features != (FAT32_SYM(cpu_features)() & wide_features))
+    {
+        return;
+    }
+
+    fill_pattern(buffer, sizeof(buffer), PATTERN_SEED);
+
+    for (size_t offset = 0; offset < 64; offset += 7)
+    {
+        for (size_t size = first; size <= last; ++size)
+        {
+            TEST_EXPECT(
+                FAT32_SYM(crc32_kernel_bytewise)(
+                    0xffffffff, buffer + offset, size)
+                    == FAT32_SYM(crc32_kernel_vpclmul)(
+                            0xffffffff, buffer + offset, size));
+        }
+    }
+}
+#endif
+
+/**
+ * The selected kernel matches the bytewise kernel, including when resuming from
+ * a partial register.
+ */
+TEST(crc32_kernel_selected_matches_bytewise)
+{
+    uint8_t buffer[4096];
+
+    fill_pattern(buffer, sizeof(buffer), PATTERN_SEED);
+
+    for (size_t split = 0; split <= sizeof(buffer); split += 127)
+    {
+        uint32_t expected =
+            FAT32_SYM(crc32_kernel_bytewise)(
+                0xffffffff, buffer, sizeof(buffer));
+        uint32_t crc = FAT32_SYM(crc32_kernel)(0xffffffff, buffer, split);
+        crc =
+            FAT32_SYM(crc32_kernel)(
+                crc, buffer + split, sizeof(buffer) - split);
+
+        TEST_EXPECT(expected == crc);
+    }
+}
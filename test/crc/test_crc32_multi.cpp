@@ -0,0 +1,141 @@
+/**
+ * \file test/crc/test_crc32_multi.cpp
+ *
+ * \brief Unit tests for the multi-buffer CRC-32.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/crc/crc32_internal.h"
+#include "../test_pattern.h"
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_multi);
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x13579bdf
+
+/**
+ * \brief Check a multi-buffer kernel against the bytewise kernel for buffers
+ * of equal and of mixed sizes, at several alignments.
+ */
+static bool multi4_kernel_matches(FAT32_SYM(crc32_multi4_kernel_fn) kernel)
+{
+    uint8_t data[4][16 + 300];
+
+    for (int i = 0; i < 4; ++i)
+    {
+        fill_pattern(data[i], sizeof(data[i]), PATTERN_SEED);
+        data[i][0] ^= (uint8_t)i;
+    }
+
+    for (size_t offset = 0; offset < 16; offset += 5)
+    {
+        for (size_t size = 0; size <= 300; ++size)
+        {
+            const size_t equal[4] = { size, size, size, size };
+            const size_t mixed[4] = {
+                size, (size * 7) % 301, (size + 17) % 301, 300 - size };
+            const size_t* const cases[2] = { equal, mixed };
+
+            for (int c = 0; c < 2; ++c)
+            {
+                const void* const bufs[4] = {
+                    data[0] + offset, data[1] + offset, data[2] + offset,
+                    data[3] + offset };
+                uint32_t crc[4] = {
+                    0xffffffff, 0x12345678, 0, 0xdeadbeef };
+                uint32_t expected[4];
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    expected[i] =
+                        FAT32_SYM(crc32_kernel_bytewise)(
+                            crc[i], bufs[i], cases[c][i]);
+                }
+
+                kernel(crc, bufs, cases[c]);
+
+                if (0 != memcmp(crc, expected, sizeof(crc)))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Each multi-buffer result matches crc32, including for a count that isn't a
+ * multiple of four and for groups above and below the threshold.
+ */
+TEST(crc32_multi_matches_crc32)
+{
+    static uint8_t data[11][1000];
+    const size_t sizes[11] = { 9, 0, 64, 255, 256, 999, 16, 17, 1, 500, 33 };
+    const void* bufs[11];
+    uint32_t out[11];
+
+    for (int i = 0; i < 11; ++i)
+    {
+        fill_pattern(data[i], sizeof(data[i]), PATTERN_SEED);
+        data[i][0] ^= (uint8_t)i;
+        bufs[i] = data[i];
+    }
+
+    memcpy(data[0], "123456789", 9);
+
+    crc32_multi(bufs, sizes, out, 11);
+
+    TEST_EXPECT(0xcbf43926 == out[0]);
+    for (int i = 0; i < 11; ++i)
+    {
+        TEST_EXPECT(crc32(bufs[i], sizes[i]) == out[i]);
+    }
+}
+
+/**
+ * An empty batch writes nothing.
+ */
+TEST(crc32_multi_empty)
+{
+    uint32_t out = 0x55555555;
+
+    crc32_multi(NULL, NULL, &out, 0);
+
+    TEST_EXPECT(0x55555555 == out);
+}
+
+/**
+ * The slicing-by-16 multi-buffer kernel matches the bytewise kernel.
+ */
+TEST(crc32_multi4_slice16_matches)
+{
+    TEST_EXPECT(multi4_kernel_matches(&FAT32_SYM(crc32_multi4_slice16)));
+}
+
+#if defined(__x86_64__)
+/**
+ * The PCLMUL multi-buffer kernel matches the bytewise kernel.
+ */
+TEST(crc32_multi4_pclmul_matches)
+{
+    /* skip this test on hosts without carry-less multiply. */
+    if (!(FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_PCLMUL))
+    {
+        return;
+    }
+
+    TEST_EXPECT(multi4_kernel_matches(&FAT32_SYM(crc32_multi4_pclmul)));
+}
+#endif
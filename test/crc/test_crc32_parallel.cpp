@@ -0,0 +1,50 @@
+/**
+ * \file test/crc/test_crc32_parallel.cpp
+ *
+ * \brief Unit tests for the multi-threaded CRC-32.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_parallel);
+
+/**
+ * Small sections produce the same CRC-32 as the single threaded function.
+ */
+TEST(crc32_parallel_small)
+{
+    TEST_EXPECT(0xcbf43926 == crc32_parallel("123456789", 9, 4));
+    TEST_EXPECT(crc32("", 0) == crc32_parallel("", 0, 4));
+}
+
+/**
+ * Large sections produce the same CRC-32 as the single threaded function for
+ * any thread count, including the default.
+ */
+TEST(crc32_parallel_matches_crc32)
+{
+    const size_t size = 5 * 1024 * 1024 + 3;
+    uint8_t* buffer = (uint8_t*)malloc(size);
+    TEST_ASSERT(NULL != buffer);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        buffer[i] = (uint8_t)(i * 2654435761U >> 13);
+    }
+
+    const uint32_t expected = crc32(buffer, size);
+    for (unsigned int nthreads = 0; nthreads <= 8; ++nthreads)
+    {
+        TEST_EXPECT(expected == crc32_parallel(buffer, size, nthreads));
+    }
+
+    free(buffer);
+}
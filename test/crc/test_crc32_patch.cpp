@@ -0,0 +1,120 @@
+/**
+ * \file test/crc/test_crc32_patch.cpp
+ *
+ * \brief Unit tests for patching CRC-32 values.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <string.h>
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_patch);
+
+/**
+ * Patching a single byte of the Ross N. Williams test vector yields the CRC-32
+ * of the patched vector.
+ */
+TEST(crc32_patch_base_test)
+{
+    char input[] = "123456789";
+
+    for (size_t offset = 0; offset < 9; ++offset)
+    {
+        char old_byte = input[offset];
+        char new_byte = 'x';
+
+        input[offset] = new_byte;
+        uint32_t expected = crc32(input, 9);
+        input[offset] = old_byte;
+
+        TEST_EXPECT(
+            expected
+                == crc32_patch(0xcbf43926, 9, offset, &old_byte, &new_byte, 1));
+    }
+}
+
+/**
+ * An empty patch, or a patch that changes nothing, leaves the CRC-32 as it was.
+ */
+TEST(crc32_patch_unchanged)
+{
+    const char* input = "123456789";
+
+    TEST_EXPECT(0xcbf43926 == crc32_patch(0xcbf43926, 9, 4, "", "", 0));
+    TEST_EXPECT(
+        0xcbf43926 == crc32_patch(0xcbf43926, 9, 2, input + 2, input + 2, 5));
+}
+
+/**
+ * Replacing one 128-byte entry of a 16 KiB partition entry array yields the
+ * CRC-32 of the updated array, for entries at the start, middle, and end.
+ */
+TEST(crc32_patch_partition_entry)
+{
+    static uint8_t array[16384];
+    uint8_t old_entry[128];
+    uint8_t new_entry[128];
+
+    for (size_t i = 0; i < sizeof(array); ++i)
+    {
+        array[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+
+    for (size_t i = 0; i < sizeof(new_entry); ++i)
+    {
+        new_entry[i] = (uint8_t)(0xa5 ^ i);
+    }
+
+    const size_t entries[] = { 0, 1, 63, 127 };
+    for (size_t e = 0; e < sizeof(entries) / sizeof(entries[0]); ++e)
+    {
+        size_t offset = entries[e] * sizeof(new_entry);
+        uint32_t old_crc = crc32(array, sizeof(array));
+
+        memcpy(old_entry, array + offset, sizeof(old_entry));
+        memcpy(array + offset, new_entry, sizeof(new_entry));
+
+        TEST_EXPECT(
+            crc32(array, sizeof(array))
+                == crc32_patch(
+                        old_crc, sizeof(array), offset, old_entry, new_entry,
+                        sizeof(new_entry)));
+    }
+}
+
+/**
+ * Patches larger than the internal block size yield the CRC-32 of the updated
+ * buffer.
+ */
+TEST(crc32_patch_large)
+{
+    static uint8_t buffer[4096];
+    static uint8_t old_bytes[1000];
+    static uint8_t new_bytes[1000];
+
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        buffer[i] = (uint8_t)(i * 7);
+    }
+
+    for (size_t i = 0; i < sizeof(new_bytes); ++i)
+    {
+        new_bytes[i] = (uint8_t)(i * 13 + 1);
+    }
+
+    uint32_t old_crc = crc32(buffer, sizeof(buffer));
+    memcpy(old_bytes, buffer + 1001, sizeof(old_bytes));
+    memcpy(buffer + 1001, new_bytes, sizeof(new_bytes));
+
+    TEST_EXPECT(
+        crc32(buffer, sizeof(buffer))
+            == crc32_patch(
+                    old_crc, sizeof(buffer), 1001, old_bytes, new_bytes,
+                    sizeof(new_bytes)));
+}
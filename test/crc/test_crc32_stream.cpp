@@ -0,0 +1,101 @@
+/**
+ * \file test/crc/test_crc32_stream.cpp
+ *
+ * \brief Unit tests for the streaming CRC-32 interface.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <string.h>
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32_stream);
+
+/**
+ * An initialized state with no updates has the CRC-32 of an empty buffer.
+ */
+TEST(crc32_stream_empty)
+{
+    crc32_state state;
+
+    crc32_init(&state);
+
+    TEST_EXPECT(crc32("", 0) == crc32_final(&state));
+}
+
+/**
+ * Updating a state with the Ross N. Williams test vector in pieces produces the
+ * expected CRC-32.
+ */
+TEST(crc32_stream_base_test)
+{
+    const uint32_t EXPECTED_RESULT = 0xcbf43926;
+    crc32_state state;
+
+    crc32_init(&state);
+    crc32_update(&state, "1234", 4);
+    crc32_update(&state, "", 0);
+    crc32_update(&state, "5", 1);
+    crc32_update(&state, "6789", 4);
+
+    TEST_EXPECT(EXPECTED_RESULT == crc32_final(&state));
+}
+
+/**
+ * Streaming a buffer one sector at a time matches a single CRC-32 over it.
+ */
+TEST(crc32_stream_sectors)
+{
+    uint8_t buffer[128 * 128];
+    crc32_state state;
+
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        buffer[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    crc32_init(&state);
+    for (size_t offset = 0; offset < sizeof(buffer); offset += 512)
+    {
+        crc32_update(&state, buffer + offset, 512);
+    }
+
+    TEST_EXPECT(crc32(buffer, sizeof(buffer)) == crc32_final(&state));
+}
+
+/**
+ * Finalizing a state does not modify it.
+ */
+TEST(crc32_stream_final_is_idempotent)
+{
+    crc32_state state;
+
+    crc32_init(&state);
+    crc32_update(&state, "12345", 5);
+    TEST_EXPECT(crc32("12345", 5) == crc32_final(&state));
+
+    crc32_update(&state, "6789", 4);
+    TEST_EXPECT(0xcbf43926 == crc32_final(&state));
+}
+
+/**
+ * A vectored CRC-32 matches a CRC-32 over the concatenated sections.
+ */
+TEST(crc32_iov_basics)
+{
+    char first[] = "123";
+    char second[] = "";
+    char third[] = "456789";
+    struct iovec iov[3] = {
+        { first, 3 },
+        { second, 0 },
+        { third, 6 } };
+
+    TEST_EXPECT(0xcbf43926 == crc32_iov(iov, 3));
+    TEST_EXPECT(crc32("", 0) == crc32_iov(iov, 0));
+}
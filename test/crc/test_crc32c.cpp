@@ -0,0 +1,130 @@
+/**
+ * \file test/crc/test_crc32c.cpp
+ *
+ * \brief Unit tests for CRC-32C.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/crc/crc32_internal.h"
+#include "../test_pattern.h"
+
+FAT32_IMPORT_crc;
+
+TEST_SUITE(crc32c);
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x87654321
+
+/**
+ * \brief Update a raw CRC-32C register one byte at a time.
+ */
+static uint32_t crc32c_bytewise(uint32_t crc, const uint8_t* data, size_t size)
+{
+    while (size--)
+    {
+        crc = FAT32_SYM(crc32c_constants)[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+/**
+ * CRC-32C produces the Ross N. Williams test vector.
+ */
+TEST(crc32c_base_test)
+{
+    TEST_EXPECT(0xe3069283 == crc32c("123456789", 9));
+    TEST_EXPECT(0x00000000 == crc32c("", 0));
+}
+
+/**
+ * CRC-32C produces the test vectors from RFC 3720, appendix B.4.
+ */
+TEST(crc32c_rfc3720_vectors)
+{
+    uint8_t buffer[32];
+
+    memset(buffer, 0, sizeof(buffer));
+    TEST_EXPECT(0x8a9136aa == crc32c(buffer, sizeof(buffer)));
+
+    memset(buffer, 0xff, sizeof(buffer));
+    TEST_EXPECT(0x62a8ab43 == crc32c(buffer, sizeof(buffer)));
+
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        buffer[i] = (uint8_t)i;
+    }
+    TEST_EXPECT(0x46dd794e == crc32c(buffer, sizeof(buffer)));
+
+    for (size_t i = 0; i < sizeof(buffer); ++i)
+    {
+        buffer[i] = (uint8_t)(31 - i);
+    }
+    TEST_EXPECT(0x113fdb5c == crc32c(buffer, sizeof(buffer)));
+}
+
+/**
+ * The slicing-by-16 kernel matches the bytewise update for every size and
+ * alignment through several blocks.
+ */
+TEST(crc32c_kernel_slice16_matches_bytewise)
+{
+    uint8_t buffer[16 + 300];
+
+    fill_pattern(buffer, sizeof(buffer), PATTERN_SEED);
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        for (size_t size = 0; size <= 300; ++size)
+        {
+            TEST_EXPECT(
+                crc32c_bytewise(0xffffffff, buffer + offset, size)
+                    == FAT32_SYM(crc32c_kernel_slice16)(
+                            0xffffffff, buffer + offset, size));
+        }
+    }
+}
+
+#if defined(__x86_64__)
+/**
+ * The SSE4.2 kernel matches the slicing-by-16 kernel across the short lane and
+ * long lane block sizes, for several alignments.
+ */
+TEST(crc32c_kernel_sse42_matches_slice16)
+{
+    const uint32_t hw_features =
+        FAT32_CPU_FEATURE_SSE42 | FAT32_CPU_FEATURE_PCLMUL;
+    static uint8_t buffer[8 + 2 * 3 * 4096 + 3 * 256 + 64];
+    const size_t sizes[] = {
+        0, 1, 7, 8, 9, 767, 768, 769, 1536 + 15, 3 * 4096 - 1, 3 * 4096,
+        3 * 4096 + 1, 2 * 3 * 4096 + 3 * 256 + 63 };
+
+    /* skip this test on hosts without SSE4.2 and carry-less multiply. */
+    if (hw_features != (FAT32_SYM(cpu_features)() & hw_features))
+    {
+        return;
+    }
+
+    fill_pattern(buffer, sizeof(buffer), PATTERN_SEED);
+
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        {
+            TEST_EXPECT(
+                FAT32_SYM(crc32c_kernel_slice16)(
+                    0xffffffff, buffer + offset, sizes[i])
+                    == FAT32_SYM(crc32c_kernel_sse42)(
+                            0xffffffff, buffer + offset, sizes[i]));
+        }
+    }
+}
+#endif
@@ -0,0 +1,342 @@
+/**
+ * \file test/gpt/test_header.cpp
+ *
+ * \brief Unit tests for the GPT header interface.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/crc.h>
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
+
+FAT32_IMPORT_crc;
+FAT32_IMPORT_guid;
+FAT32_IMPORT_gpt;
+
+TEST_SUITE(gpt_header);
+
+/* The size of an LBA. */
+#define LBA_SIZE                                                          512
+
+/* The last lba of a 128 MiB disk. */
+#define END_LBA                                 (128UL * 1024UL * 2UL - 1UL)
+
+/**
+ * \brief Load a little-endian 32-bit word.
+ */
+static uint32_t load_le32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0])       | ((uint32_t)p[1] <<  8)
+      | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * \brief Store a little-endian 32-bit word.
+ */
+static void store_le32(uint8_t* p, uint32_t value)
+{
+    for (size_t i = 0; i < 4; ++i)
+    {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+ * \brief Compute the CRC of a serialized header of the given size.
+ */
+static uint32_t header_crc32(const uint8_t* sector, size_t header_size)
+{
+    std::vector<uint8_t> copy(sector, sector + header_size);
+    memset(copy.data() + FAT32_GPT_HEADER_CRC32_OFFSET, 0, 4);
+
+    return crc32(copy.data(), copy.size());
+}
+
+/**
+ * \brief Compare two headers field by field, since the struct is padded.
+ */
+static bool same_header(const gpt_header* x, const gpt_header* y)
+{
+    return
+        0 == memcmp(x->signature, y->signature, sizeof(x->signature))
+     && x->revision == y->revision
+     && x->header_size == y->header_size
+     && x->header_crc32 == y->header_crc32
+     && 0 == memcmp(x->reserved, y->reserved, sizeof(x->reserved))
+     && x->my_lba == y->my_lba
+     && x->alternative_lba == y->alternative_lba
+     && x->first_usable_lba == y->first_usable_lba
+     && x->last_usable_lba == y->last_usable_lba
+     && guid_equal(&x->disk_guid, &y->disk_guid)
+     && x->partition_entry_lba == y->partition_entry_lba
+     && x->number_of_partition_entries == y->number_of_partition_entries
+     && x->size_of_partition_entry == y->size_of_partition_entry
+     && x->partition_entry_array_crc32 == y->partition_entry_array_crc32;
+}
+
+/**
+ * \brief Initialize a header spanning a 128 MiB disk.
+ */
+static int span_header(gpt_header* header)
+{
+    guid disk_guid;
+    int retval =
+        guid_init_from_string(
+            &disk_guid, "8c2a4b1e-53f0-4d6e-9a71-0b3c5d7e9f21");
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return gpt_header_init_span(header, &disk_guid, 1, END_LBA);
+}
+
+/**
+ * A spanning header describes the primary header and an empty default
+ * partition entry array.
+ */
+TEST(gpt_header_init_span_fields)
+{
+    gpt_header header;
+    guid disk_guid;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_init_from_string(
+                    &disk_guid, "8c2a4b1e-53f0-4d6e-9a71-0b3c5d7e9f21"));
+
+    /* precondition: fill with junk. */
+    memset(&header, 0xa5, sizeof(header));
+
+    TEST_ASSERT(STATUS_SUCCESS == span_header(&header));
+
+    TEST_EXPECT(
+        0 == memcmp(
+                header.signature, FAT32_GPT_HEADER_SIGNATURE,
+                FAT32_GPT_HEADER_SIGNATURE_SIZE));
+    TEST_EXPECT(FAT32_GPT_HEADER_REVISION == header.revision);
+    TEST_EXPECT(FAT32_GPT_HEADER_SIZE == header.header_size);
+    TEST_EXPECT(0 == header.reserved[0] && 0 == header.reserved[3]);
+    TEST_EXPECT(1 == header.my_lba);
+    TEST_EXPECT(END_LBA == header.alternative_lba);
+    TEST_EXPECT(34 == header.first_usable_lba);
+    TEST_EXPECT(END_LBA - 33 == header.last_usable_lba);
+    TEST_EXPECT(guid_equal(&disk_guid, &header.disk_guid));
+    TEST_EXPECT(2 == header.partition_entry_lba);
+    TEST_EXPECT(128 == header.number_of_partition_entries);
+    TEST_EXPECT(128 == header.size_of_partition_entry);
+
+    /* the array CRC is the CRC of an empty entry array. */
+    std::vector<uint8_t> entries(128 * 128, 0);
+    TEST_EXPECT(
+        crc32(entries.data(), entries.size())
+            == header.partition_entry_array_crc32);
+}
+
+/**
+ * A header is written with its stored CRC, and the rest of the sector is
+ * cleared.
+ */
+TEST(gpt_header_write_sector)
+{
+    gpt_header header;
+    uint8_t sector[LBA_SIZE];
+
+    TEST_ASSERT(STATUS_SUCCESS == span_header(&header));
+
+    memset(sector, 0xa5, sizeof(sector));
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_write(sector, sizeof(sector), &header));
+
+    TEST_EXPECT(
+        0 == memcmp(
+                sector, FAT32_GPT_HEADER_SIGNATURE,
+                FAT32_GPT_HEADER_SIGNATURE_SIZE));
+    TEST_EXPECT(FAT32_GPT_HEADER_SIZE == load_le32(sector + 12));
+    TEST_EXPECT(
+        header.header_crc32
+            == load_le32(sector + FAT32_GPT_HEADER_CRC32_OFFSET));
+    TEST_EXPECT(
+        header_crc32(sector, FAT32_GPT_HEADER_SIZE) == header.header_crc32);
+
+    size_t nonzero = 0;
+    for (size_t i = FAT32_GPT_HEADER_SIZE; i < sizeof(sector); ++i)
+    {
+        nonzero += 0 != sector[i];
+    }
+
+    TEST_EXPECT(0 == nonzero);
+
+    /* the written header is accepted by the GPT probe. */
+    uint8_t disk[2 * LBA_SIZE];
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_protective_mbr_write_span(
+                    disk, LBA_SIZE, (END_LBA + 1) * LBA_SIZE));
+    memcpy(disk + LBA_SIZE, sector, LBA_SIZE);
+    TEST_EXPECT(FAT32_GPT_PROBE_GPT == gpt_probe(disk, sizeof(disk)));
+}
+
+/**
+ * A written header reads back as the same header.
+ */
+TEST(gpt_header_round_trip)
+{
+    gpt_header header;
+    gpt_header read_header;
+    uint8_t sector[LBA_SIZE];
+
+    TEST_ASSERT(STATUS_SUCCESS == span_header(&header));
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_write(sector, sizeof(sector), &header));
+
+    memset(&read_header, 0xa5, sizeof(read_header));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_header_read(&read_header, sector, sizeof(sector)));
+    TEST_EXPECT(same_header(&header, &read_header));
+
+    /* a region that holds just the header also works. */
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == gpt_header_read(&read_header, sector, FAT32_GPT_HEADER_SIZE));
+}
+
+/**
+ * Changing a field and updating the CRC gives a header that reads back.
+ */
+TEST(gpt_header_update_crc32)
+{
+    gpt_header header;
+    gpt_header read_header;
+    uint8_t sector[LBA_SIZE];
+
+    TEST_ASSERT(STATUS_SUCCESS == span_header(&header));
+
+    /* a stale CRC is written as is, and rejected on read. */
+    header.partition_entry_array_crc32 = 0x12345678;
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_write(sector, sizeof(sector), &header));
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_HEADER_BAD_CRC
+            == gpt_header_read(&read_header, sector, sizeof(sector)));
+
+    gpt_header_update_crc32(&header);
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_write(sector, sizeof(sector), &header));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_header_read(&read_header, sector, sizeof(sector)));
+    TEST_EXPECT(0x12345678 == read_header.partition_entry_array_crc32);
+
+    /* a larger header is CRCed over its cleared tail. */
+    header.header_size = 200;
+    gpt_header_update_crc32(&header);
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE == gpt_header_write(sector, 199, &header));
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_write(sector, sizeof(sector), &header));
+    TEST_EXPECT(header_crc32(sector, 200) == header.header_crc32);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_header_read(&read_header, sector, sizeof(sector)));
+    TEST_EXPECT(same_header(&header, &read_header));
+}
+
+/**
+ * Reading rejects bad sizes, signatures, CRCs, and records.
+ */
+TEST(gpt_header_read_errors)
+{
+    gpt_header header;
+    gpt_header read_header;
+    uint8_t sector[LBA_SIZE];
+    uint8_t bad[LBA_SIZE];
+
+    TEST_ASSERT(STATUS_SUCCESS == span_header(&header));
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_write(sector, sizeof(sector), &header));
+
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_header_read(
+                    &read_header, sector, FAT32_GPT_HEADER_SIZE - 1));
+
+    memcpy(bad, sector, sizeof(bad));
+    bad[0] = 'X';
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_HEADER_BAD_SIGNATURE
+            == gpt_header_read(&read_header, bad, sizeof(bad)));
+
+    /* any changed byte in the header is caught by the CRC. */
+    size_t missed = 0;
+    for (size_t i = FAT32_GPT_HEADER_SIGNATURE_SIZE;
+         i < FAT32_GPT_HEADER_SIZE; ++i)
+    {
+        memcpy(bad, sector, sizeof(bad));
+        bad[i] ^= 0x01;
+        int retval = gpt_header_read(&read_header, bad, sizeof(bad));
+        missed += STATUS_SUCCESS == retval;
+    }
+
+    TEST_EXPECT(0 == missed);
+
+    /* a header size outside of the region is a bad record. */
+    memcpy(bad, sector, sizeof(bad));
+    store_le32(bad + 12, FAT32_GPT_HEADER_SIZE - 1);
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_RECORD
+            == gpt_header_read(&read_header, bad, sizeof(bad)));
+    store_le32(bad + 12, LBA_SIZE + 1);
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_RECORD
+            == gpt_header_read(&read_header, bad, sizeof(bad)));
+
+    /* a bad entry size with a good CRC is a bad record. */
+    memcpy(bad, sector, sizeof(bad));
+    store_le32(bad + 84, 96);
+    store_le32(
+        bad + FAT32_GPT_HEADER_CRC32_OFFSET,
+        header_crc32(bad, FAT32_GPT_HEADER_SIZE));
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_RECORD
+            == gpt_header_read(&read_header, bad, sizeof(bad)));
+}
+
+/**
+ * Initialization fails if the disk is too small for the GPT structures.
+ */
+TEST(gpt_header_init_bad_size)
+{
+    gpt_header header;
+    guid disk_guid;
+
+    memset(&disk_guid, 0x5a, sizeof(disk_guid));
+
+    /* two usable lbas is the smallest span. */
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_header_init_span(&header, &disk_guid, 1, 67));
+    TEST_ASSERT(
+        STATUS_SUCCESS == gpt_header_init_span(&header, &disk_guid, 1, 68));
+    TEST_EXPECT(header.first_usable_lba + 1 == header.last_usable_lba);
+
+    /* the primary array must end before the first usable lba. */
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_header_init(&header, &disk_guid, 33, 1000, 1033));
+
+    /* the backup array must end before the backup header. */
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_header_init(&header, &disk_guid, 34, 1000, 1032));
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == gpt_header_init(&header, &disk_guid, 34, 1000, 1033));
+}
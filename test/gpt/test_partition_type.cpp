@@ -0,0 +1,145 @@
+/**
+ * \file test/gpt/test_partition_type.cpp
+ *
+ * \brief Unit tests for the partition type registry.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+#include "../test_pattern.h"
+
+FAT32_IMPORT_gpt;
+FAT32_IMPORT_guid;
+
+TEST_SUITE(partition_type);
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x01234567
+
+/**
+ * \brief A partition type and its guid string, checked independently of the
+ * generator's registry.
+ */
+struct known_type
+{
+    gpt_partition_type type;
+    const char* guid;
+};
+
+static const known_type known_types[] = {
+    { FAT32_GPT_PARTITION_TYPE_UNUSED,
+      "00000000-0000-0000-0000-000000000000" },
+    { FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM,
+      "c12a7328-f81f-11d2-ba4b-00a0c93ec93b" },
+    { FAT32_GPT_PARTITION_TYPE_BIOS_BOOT,
+      "21686148-6449-6e6f-744e-656564454649" },
+    { FAT32_GPT_PARTITION_TYPE_MICROSOFT_BASIC_DATA,
+      "ebd0a0a2-b9e5-4433-87c0-68b6b72699c7" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_FILESYSTEM,
+      "0fc63daf-8483-4772-8e79-3d69d8477de4" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_SWAP,
+      "0657fd6d-a4ab-43c4-84e5-0933c84b4f4f" },
+    { FAT32_GPT_PARTITION_TYPE_LINUX_ROOT_X86_64,
+      "4f68bce3-e8cd-4db1-96e7-fbcaf984b709" },
+    { FAT32_GPT_PARTITION_TYPE_APPLE_HFS_PLUS,
+      "48465300-0000-11aa-aa11-00306543ecac" },
+    { FAT32_GPT_PARTITION_TYPE_APPLE_APFS,
+      "7c3457ef-0000-11aa-aa11-00306543ecac" },
+};
+
+/**
+ * \brief Encode a guid string in its on-disk form.
+ */
+static bool encode(uint8_t* raw, const char* str)
+{
+    guid id;
+
+    return
+        STATUS_SUCCESS == guid_init_from_string(&id, str)
+     && STATUS_SUCCESS
+            == guid_write_to_binary(raw, FAT32_GUID_BINARY_SIZE, &id);
+}
+
+/**
+ * Well-known type guids classify as their types.
+ */
+TEST(gpt_partition_type_from_raw_known)
+{
+    for (const known_type& known : known_types)
+    {
+        uint8_t raw[FAT32_GUID_BINARY_SIZE];
+
+        TEST_ASSERT(encode(raw, known.guid));
+        TEST_EXPECT(known.type == gpt_partition_type_from_raw(raw));
+    }
+}
+
+/**
+ * Every registered type round trips through its guid, and any single byte
+ * change makes the guid unknown or a different type.
+ */
+TEST(gpt_partition_type_round_trip)
+{
+    for (int i = 1; i < FAT32_GPT_PARTITION_TYPE_COUNT; ++i)
+    {
+        gpt_partition_type type = (gpt_partition_type)i;
+        uint8_t raw[FAT32_GUID_BINARY_SIZE];
+        guid id;
+
+        TEST_ASSERT(STATUS_SUCCESS == gpt_partition_type_guid(&id, type));
+        TEST_ASSERT(
+            STATUS_SUCCESS == guid_write_to_binary(raw, sizeof(raw), &id));
+        TEST_EXPECT(type == gpt_partition_type_from_raw(raw));
+
+        for (size_t j = 0; j < sizeof(raw); ++j)
+        {
+            raw[j] ^= 0x10;
+            TEST_EXPECT(type != gpt_partition_type_from_raw(raw));
+            raw[j] ^= 0x10;
+        }
+    }
+}
+
+/**
+ * Other guids are unknown.
+ */
+TEST(gpt_partition_type_from_raw_unknown)
+{
+    uint8_t raw[FAT32_GUID_BINARY_SIZE];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        fill_pattern(raw, sizeof(raw), PATTERN_SEED + i);
+
+        TEST_EXPECT(
+            FAT32_GPT_PARTITION_TYPE_UNKNOWN
+                == gpt_partition_type_from_raw(raw));
+    }
+
+    /* all ones is the placeholder guid of the unknown type. */
+    memset(raw, 0xff, sizeof(raw));
+    TEST_EXPECT(
+        FAT32_GPT_PARTITION_TYPE_UNKNOWN == gpt_partition_type_from_raw(raw));
+}
+
+/**
+ * The unknown type and out of range types have no guid.
+ */
+TEST(gpt_partition_type_guid_bad_type)
+{
+    guid id;
+
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_PARTITION_TYPE
+            == gpt_partition_type_guid(&id, FAT32_GPT_PARTITION_TYPE_UNKNOWN));
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_PARTITION_TYPE
+            == gpt_partition_type_guid(&id, FAT32_GPT_PARTITION_TYPE_COUNT));
+}
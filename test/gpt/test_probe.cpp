@@ -0,0 +1,153 @@
+/**
+ * \file test/gpt/test_probe.cpp
+ *
+ * \brief Unit tests for the GPT probe.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+FAT32_IMPORT_gpt;
+
+TEST_SUITE(gpt_probe);
+
+/**
+ * \brief Write a protective MBR to LBA 0 and, if requested, the GPT header
+ * signature to LBA 1.
+ */
+static bool write_image(uint8_t* image, bool header)
+{
+    gpt_protective_mbr mbr;
+    const size_t disk_size = 128UL * 1024UL * 1024UL * 1024UL;
+
+    memset(image, 0x5a, FAT32_GPT_PROBE_MINIMUM_SIZE);
+
+    if (
+        STATUS_SUCCESS != gpt_protective_mbr_init_span(&mbr, disk_size)
+     || STATUS_SUCCESS
+            != gpt_protective_mbr_write(
+                    image, FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE, &mbr))
+    {
+        return false;
+    }
+
+    if (header)
+    {
+        memcpy(
+            image + FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE,
+            FAT32_GPT_HEADER_SIGNATURE, FAT32_GPT_HEADER_SIGNATURE_SIZE);
+    }
+
+    return true;
+}
+
+/**
+ * A protective MBR followed by a GPT header signature is a GPT.
+ */
+TEST(gpt_probe_gpt)
+{
+    uint8_t image[FAT32_GPT_PROBE_MINIMUM_SIZE];
+
+    TEST_ASSERT(write_image(image, true));
+
+    TEST_EXPECT(FAT32_GPT_PROBE_GPT == gpt_probe(image, sizeof(image)));
+}
+
+/**
+ * A protective MBR without a GPT header signature has no header.
+ */
+TEST(gpt_probe_no_header)
+{
+    uint8_t image[FAT32_GPT_PROBE_MINIMUM_SIZE];
+
+    TEST_ASSERT(write_image(image, false));
+
+    TEST_EXPECT(FAT32_GPT_PROBE_NO_HEADER == gpt_probe(image, sizeof(image)));
+}
+
+/**
+ * An MBR with a non-protective first record or a disk signature is a legacy
+ * MBR.
+ */
+TEST(gpt_probe_legacy_mbr)
+{
+    uint8_t image[FAT32_GPT_PROBE_MINIMUM_SIZE];
+
+    TEST_ASSERT(write_image(image, true));
+    image[FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET + 4] = 0x83;
+    TEST_EXPECT(
+        FAT32_GPT_PROBE_LEGACY_MBR == gpt_probe(image, sizeof(image)));
+
+    TEST_ASSERT(write_image(image, true));
+    image[FAT32_GPT_PROTECTIVE_MBR_UNIQUE_DISK_SIGNATURE_OFFSET + 3] = 0x01;
+    TEST_EXPECT(
+        FAT32_GPT_PROBE_LEGACY_MBR == gpt_probe(image, sizeof(image)));
+}
+
+/**
+ * Sectors without the MBR signature aren't an MBR.
+ */
+TEST(gpt_probe_no_mbr)
+{
+    uint8_t image[FAT32_GPT_PROBE_MINIMUM_SIZE];
+
+    TEST_ASSERT(write_image(image, true));
+    image[FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET + 1] = 0x00;
+
+    TEST_EXPECT(FAT32_GPT_PROBE_NO_MBR == gpt_probe(image, sizeof(image)));
+}
+
+/**
+ * An image smaller than two sectors can't be probed.
+ */
+TEST(gpt_probe_bad_size)
+{
+    uint8_t image[FAT32_GPT_PROBE_MINIMUM_SIZE];
+
+    TEST_ASSERT(write_image(image, true));
+
+    TEST_EXPECT(
+        FAT32_GPT_PROBE_BAD_SIZE == gpt_probe(image, sizeof(image) - 1));
+}
+
+/**
+ * The probe never rejects an MBR that a full read accepts.
+ */
+TEST(gpt_probe_accepts_readable_mbr)
+{
+    uint8_t image[FAT32_GPT_PROBE_MINIMUM_SIZE];
+    gpt_protective_mbr mbr;
+    size_t readable = 0;
+    size_t rejected = 0;
+
+    for (size_t offset = 440; offset < 512; ++offset)
+    {
+        for (unsigned int value = 0; value < 256; value += 17)
+        {
+            TEST_ASSERT(write_image(image, false));
+            image[offset] = (uint8_t)value;
+
+            if (
+                STATUS_SUCCESS
+                    == gpt_protective_mbr_read(
+                            &mbr, image, FAT32_GPT_PROTECTIVE_MBR_MINIMUM_SIZE))
+            {
+                ++readable;
+                if (
+                    FAT32_GPT_PROBE_NO_HEADER
+                        != gpt_probe(image, sizeof(image)))
+                {
+                    ++rejected;
+                }
+            }
+        }
+    }
+
+    TEST_EXPECT(readable > 0);
+    TEST_EXPECT(0 == rejected);
+}
@@ -664,3 +664,203 @@ TEST(gpt_protective_mbr_write_and_read_small)
     /* the two records should match. */
     TEST_EXPECT(0 == memcmp(&mbr, &read_mbr, sizeof(mbr)));
 }
+
+/**
+ * A view over a written MBR reads back the same fields as the MBR.
+ */
+TEST(gpt_protective_mbr_view_init_fields)
+{
+    gpt_protective_mbr mbr;
+    gpt_protective_mbr_view view;
+    uint8_t buffer[512];
+    const size_t disk_size = 128UL * 1024UL * 1024UL * 1024UL;
+
+    /* precondition: fill buffer with junk. */
+    memset(buffer, 0x5a, sizeof(buffer));
+
+    /* create and write an mbr instance. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_protective_mbr_init_span(&mbr, disk_size));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_protective_mbr_write(buffer, sizeof(buffer), &mbr));
+
+    /* view the mbr in place. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_protective_mbr_view_init(&view, buffer, sizeof(buffer)));
+
+    /* the view reads the sector without copying it. */
+    TEST_EXPECT(buffer == gpt_protective_mbr_view_boot_code(&view));
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    mbr.boot_code, gpt_protective_mbr_view_boot_code(&view),
+                    sizeof(mbr.boot_code)));
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    mbr.unique_disk_signature,
+                    gpt_protective_mbr_view_unique_disk_signature(&view),
+                    sizeof(mbr.unique_disk_signature)));
+    TEST_EXPECT(mbr.signature == gpt_protective_mbr_view_signature(&view));
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        const gpt_protective_mbr_partition_record* rec =
+            &mbr.partition_record[i];
+
+        TEST_EXPECT(
+            rec->boot_indicator
+                == gpt_protective_mbr_view_record_boot_indicator(&view, i));
+        TEST_EXPECT(
+            rec->starting_chs
+                == gpt_protective_mbr_view_record_starting_chs(&view, i));
+        TEST_EXPECT(
+            rec->os_type == gpt_protective_mbr_view_record_os_type(&view, i));
+        TEST_EXPECT(
+            rec->ending_chs
+                == gpt_protective_mbr_view_record_ending_chs(&view, i));
+        TEST_EXPECT(
+            rec->starting_lba
+                == gpt_protective_mbr_view_record_starting_lba(&view, i));
+        TEST_EXPECT(
+            rec->size_in_lba
+                == gpt_protective_mbr_view_record_size_in_lba(&view, i));
+    }
+}
+
+/**
+ * A view can't be made over a buffer that is too small for an MBR.
+ */
+TEST(gpt_protective_mbr_view_init_too_small)
+{
+    gpt_protective_mbr_view view;
+    uint8_t buffer[511];
+
+    memset(buffer, 0, sizeof(buffer));
+
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_protective_mbr_view_init(&view, buffer, sizeof(buffer)));
+}
+
+/**
+ * Validating a view in place agrees with reading the MBR for every single
+ * byte change after the boot code.
+ */
+TEST(gpt_protective_mbr_view_init_agrees_with_read)
+{
+    gpt_protective_mbr mbr;
+    gpt_protective_mbr_view view;
+    uint8_t buffer[512];
+    const uint8_t values[] = { 0x00, 0x01, 0x02, 0x20, 0x55, 0xAA, 0xEE, 0xFF };
+    const size_t disk_size = 128UL * 1024UL * 1024UL * 1024UL;
+    size_t mismatches = 0;
+    size_t failures = 0;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_protective_mbr_init_span(&mbr, disk_size));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_protective_mbr_write(buffer, sizeof(buffer), &mbr));
+
+    for (size_t offset = 440; offset < sizeof(buffer); ++offset)
+    {
+        const uint8_t original = buffer[offset];
+
+        for (uint8_t value : values)
+        {
+            buffer[offset] = value;
+
+            int read_status =
+                gpt_protective_mbr_read(&mbr, buffer, sizeof(buffer));
+            int view_status =
+                gpt_protective_mbr_view_init(&view, buffer, sizeof(buffer));
+
+            if (read_status != view_status)
+            {
+                ++mismatches;
+            }
+
+            if (STATUS_SUCCESS != view_status)
+            {
+                ++failures;
+            }
+        }
+
+        buffer[offset] = original;
+    }
+
+    TEST_EXPECT(0 == mismatches);
+    /* some of these changes are rejected. */
+    TEST_EXPECT(failures > 0);
+}
+
+/**
+ * Writing a span MBR from the template matches init_span followed by write,
+ * for small, large, and clamped disks, and for regions larger than a sector.
+ */
+TEST(gpt_protective_mbr_write_span_matches_write)
+{
+    gpt_protective_mbr mbr;
+    uint8_t expected[1024];
+    uint8_t actual[1024];
+    const size_t disk_sizes[] = {
+        512UL * 34UL, 512UL * 34UL + 511UL, 128UL * 1024UL * 1024UL,
+        128UL * 1024UL * 1024UL * 1024UL, 0x1FFFFFFFFUL * 512UL,
+        4UL * 1024UL * 1024UL * 1024UL * 1024UL };
+    const size_t region_sizes[] = { 512, 513, 1024 };
+
+    for (size_t disk_size : disk_sizes)
+    {
+        for (size_t region_size : region_sizes)
+        {
+            /* precondition: fill both buffers with junk. */
+            memset(expected, 0x5a, sizeof(expected));
+            memset(actual, 0x5a, sizeof(actual));
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == gpt_protective_mbr_init_span(&mbr, disk_size));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == gpt_protective_mbr_write(expected, region_size, &mbr));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == gpt_protective_mbr_write_span(
+                            actual, region_size, disk_size));
+
+            TEST_EXPECT(0 == memcmp(expected, actual, sizeof(actual)));
+        }
+    }
+}
+
+/**
+ * Writing a span MBR fails like init_span and write do on bad sizes, without
+ * touching the region.
+ */
+TEST(gpt_protective_mbr_write_span_bad_size)
+{
+    uint8_t buffer[512];
+    uint8_t junk[512];
+
+    memset(buffer, 0x5a, sizeof(buffer));
+    memset(junk, 0x5a, sizeof(junk));
+
+    /* the disk is too small for GPT. */
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_protective_mbr_write_span(
+                    buffer, sizeof(buffer), 512UL * 34UL - 1UL));
+
+    /* the region is too small for an MBR. */
+    TEST_EXPECT(
+        FAT32_ERROR_GPT_BAD_SIZE
+            == gpt_protective_mbr_write_span(
+                    buffer, sizeof(buffer) - 1, 128UL * 1024UL * 1024UL));
+
+    TEST_EXPECT(0 == memcmp(buffer, junk, sizeof(buffer)));
+}
@@ -0,0 +1,307 @@
+/**
+ * \file test/gpt/test_scan.cpp
+ *
+ * \brief Unit tests for the bulk image scanner.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+FAT32_IMPORT_guid;
+FAT32_IMPORT_gpt;
+
+TEST_SUITE(gpt_scan);
+
+/* The size of an LBA. */
+#define LBA_SIZE                                                          512
+
+/* The size of a partition entry. */
+#define ENTRY_SIZE                                                        128
+
+/**
+ * \brief Store a little-endian word.
+ */
+static void store_le(uint8_t* p, uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+ * \brief Build a GPT image whose entry array starts at the given LBA and holds
+ * the given partition types.
+ */
+static std::vector<uint8_t> gpt_image(
+    uint64_t entry_lba, uint32_t entry_count,
+    const std::vector<gpt_partition_type>& types)
+{
+    std::vector<uint8_t> image((entry_lba + 34) * LBA_SIZE, 0);
+    gpt_protective_mbr mbr;
+
+    if (
+        STATUS_SUCCESS
+            != gpt_protective_mbr_init_span(&mbr, 128UL * 1024UL * 1024UL)
+     || STATUS_SUCCESS
+            != gpt_protective_mbr_write(image.data(), LBA_SIZE, &mbr))
+    {
+        image.clear();
+        return image;
+    }
+
+    uint8_t* header = image.data() + LBA_SIZE;
+    memcpy(
+        header, FAT32_GPT_HEADER_SIGNATURE, FAT32_GPT_HEADER_SIGNATURE_SIZE);
+    store_le(header + 72, entry_lba, 8);
+    store_le(header + 80, entry_count, 4);
+    store_le(header + 84, ENTRY_SIZE, 4);
+
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        guid id;
+        uint8_t* entry = image.data() + entry_lba * LBA_SIZE + i * ENTRY_SIZE;
+
+        if (
+            STATUS_SUCCESS != gpt_partition_type_guid(&id, types[i])
+         || STATUS_SUCCESS
+                != guid_write_to_binary(entry, FAT32_GUID_BINARY_SIZE, &id))
+        {
+            image.clear();
+            return image;
+        }
+    }
+
+    return image;
+}
+
+/**
+ * \brief A set of temporary image files, removed when it goes out of scope.
+ */
+class temp_images
+{
+public:
+    ~temp_images()
+    {
+        for (const std::string& path : paths)
+        {
+            unlink(path.c_str());
+        }
+    }
+
+    /**
+     * \brief Write an image to a new temporary file, returning its path, or an
+     * empty string on failure.
+     */
+    std::string add(const std::vector<uint8_t>& image)
+    {
+        char name[] = "/tmp/libfat32_scan_XXXXXX";
+        int fd = mkstemp(name);
+        if (fd < 0)
+        {
+            return "";
+        }
+
+        paths.push_back(name);
+
+        ssize_t written =
+            image.empty() ? 0 : write(fd, image.data(), image.size());
+        close(fd);
+
+        return (size_t)written == image.size() ? name : "";
+    }
+
+private:
+    std::vector<std::string> paths;
+};
+
+/**
+ * Images of every class are classified and summarized.
+ */
+TEST(gpt_scan_images_classes)
+{
+    temp_images images;
+    std::vector<uint8_t> gpt =
+        gpt_image(
+            2, 128,
+            { FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM,
+              FAT32_GPT_PARTITION_TYPE_UNUSED,
+              FAT32_GPT_PARTITION_TYPE_LINUX_FILESYSTEM,
+              FAT32_GPT_PARTITION_TYPE_LINUX_FILESYSTEM });
+    TEST_ASSERT(!gpt.empty());
+
+    std::vector<uint8_t> no_header = gpt;
+    no_header[LBA_SIZE] = 'X';
+    std::vector<uint8_t> legacy = gpt;
+    legacy[FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET + 4] = 0x83;
+    std::vector<uint8_t> no_mbr = gpt;
+    no_mbr[FAT32_GPT_PROTECTIVE_MBR_SIGNATURE_OFFSET] = 0;
+    std::vector<uint8_t> small(LBA_SIZE, 0);
+    std::vector<uint8_t> bad_array = gpt;
+    store_le(bad_array.data() + LBA_SIZE + 84, 100, 4);
+
+    std::string paths[] = {
+        images.add(gpt), images.add(no_header), images.add(legacy),
+        images.add(no_mbr), images.add(small), images.add(bad_array),
+        "/nonexistent/libfat32/image" };
+    const char* cpaths[7];
+    for (size_t i = 0; i < 7; ++i)
+    {
+        TEST_ASSERT(!paths[i].empty());
+        cpaths[i] = paths[i].c_str();
+    }
+
+    gpt_scan_result results[7];
+    TEST_ASSERT(STATUS_SUCCESS == gpt_scan_images(results, cpaths, 7, 2));
+
+    TEST_EXPECT(STATUS_SUCCESS == results[0].status);
+    TEST_EXPECT(FAT32_GPT_PROBE_GPT == results[0].probe);
+    TEST_EXPECT(STATUS_SUCCESS == results[0].mbr_status);
+    TEST_EXPECT(
+        128U * 1024U * 1024U / LBA_SIZE - 1
+            == results[0].protective_size_in_lba);
+    TEST_EXPECT(128 == results[0].partition_entry_count);
+    TEST_EXPECT(3 == results[0].partition_count);
+    TEST_EXPECT(
+        ((1U << FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM)
+       | (1U << FAT32_GPT_PARTITION_TYPE_LINUX_FILESYSTEM))
+            == results[0].partition_type_mask);
+
+    TEST_EXPECT(STATUS_SUCCESS == results[1].status);
+    TEST_EXPECT(FAT32_GPT_PROBE_NO_HEADER == results[1].probe);
+    TEST_EXPECT(STATUS_SUCCESS == results[1].mbr_status);
+    TEST_EXPECT(0 == results[1].partition_count);
+
+    TEST_EXPECT(STATUS_SUCCESS == results[2].status);
+    TEST_EXPECT(FAT32_GPT_PROBE_LEGACY_MBR == results[2].probe);
+
+    TEST_EXPECT(STATUS_SUCCESS == results[3].status);
+    TEST_EXPECT(FAT32_GPT_PROBE_NO_MBR == results[3].probe);
+
+    TEST_EXPECT(STATUS_SUCCESS == results[4].status);
+    TEST_EXPECT(FAT32_GPT_PROBE_BAD_SIZE == results[4].probe);
+
+    TEST_EXPECT(FAT32_ERROR_GPT_SCAN_BAD_ENTRY_ARRAY == results[5].status);
+    TEST_EXPECT(FAT32_GPT_PROBE_GPT == results[5].probe);
+
+    TEST_EXPECT(FAT32_ERROR_GPT_SCAN_OPEN == results[6].status);
+}
+
+/**
+ * An entry array outside of the first read is read separately.
+ */
+TEST(gpt_scan_images_distant_entry_array)
+{
+    temp_images images;
+    std::vector<uint8_t> gpt =
+        gpt_image(
+            2048, 4,
+            { FAT32_GPT_PARTITION_TYPE_MICROSOFT_BASIC_DATA,
+              FAT32_GPT_PARTITION_TYPE_LINUX_SWAP });
+    TEST_ASSERT(!gpt.empty());
+
+    std::string path = images.add(gpt);
+    TEST_ASSERT(!path.empty());
+    const char* cpath = path.c_str();
+
+    gpt_scan_result result;
+    TEST_ASSERT(STATUS_SUCCESS == gpt_scan_images(&result, &cpath, 1, 1));
+
+    TEST_EXPECT(STATUS_SUCCESS == result.status);
+    TEST_EXPECT(4 == result.partition_entry_count);
+    TEST_EXPECT(2 == result.partition_count);
+    TEST_EXPECT(
+        ((1U << FAT32_GPT_PARTITION_TYPE_MICROSOFT_BASIC_DATA)
+       | (1U << FAT32_GPT_PARTITION_TYPE_LINUX_SWAP))
+            == result.partition_type_mask);
+}
+
+/**
+ * An entry array lba too large for a file offset is a bad entry array.
+ */
+TEST(gpt_scan_images_huge_entry_lba)
+{
+    temp_images images;
+    std::vector<uint8_t> gpt =
+        gpt_image(2, 128, { FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM });
+    TEST_ASSERT(!gpt.empty());
+
+    /* the lba is large enough that its byte offset wraps past the buffer. */
+    std::vector<uint8_t> wrap = gpt;
+    store_le(wrap.data() + LBA_SIZE + 72, UINT64_MAX / LBA_SIZE, 8);
+    std::vector<uint8_t> huge = gpt;
+    store_le(huge.data() + LBA_SIZE + 72, UINT64_MAX / LBA_SIZE / 2, 8);
+
+    std::string paths[2] = { images.add(wrap), images.add(huge) };
+    TEST_ASSERT(!paths[0].empty() && !paths[1].empty());
+    const char* cpaths[2] = { paths[0].c_str(), paths[1].c_str() };
+
+    gpt_scan_result results[2];
+    TEST_ASSERT(STATUS_SUCCESS == gpt_scan_images(results, cpaths, 2, 1));
+
+    TEST_EXPECT(FAT32_ERROR_GPT_SCAN_BAD_ENTRY_ARRAY == results[0].status);
+    TEST_EXPECT(0 == results[0].partition_count);
+    TEST_EXPECT(FAT32_ERROR_GPT_SCAN_BAD_ENTRY_ARRAY == results[1].status);
+    TEST_EXPECT(0 == results[1].partition_count);
+}
+
+/**
+ * Many images on many workers each get their own result.
+ */
+TEST(gpt_scan_images_many_workers)
+{
+    temp_images images;
+    std::vector<uint8_t> gpt =
+        gpt_image(2, 128, { FAT32_GPT_PARTITION_TYPE_EFI_SYSTEM });
+    std::vector<uint8_t> legacy = gpt;
+    legacy[FAT32_GPT_PROTECTIVE_MBR_PARTITION_RECORD_OFFSET + 4] = 0x83;
+    std::string paths[2] = { images.add(gpt), images.add(legacy) };
+    TEST_ASSERT(!paths[0].empty() && !paths[1].empty());
+
+    /* alternate the two images, over a count that isn't a whole batch. */
+    const size_t count = 1000;
+    std::vector<const char*> cpaths(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        cpaths[i] = paths[i % 2].c_str();
+    }
+
+    std::vector<gpt_scan_result> results(count);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == gpt_scan_images(results.data(), cpaths.data(), count, 8));
+
+    size_t wrong = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        gpt_probe_result expected =
+            0 == i % 2 ? FAT32_GPT_PROBE_GPT : FAT32_GPT_PROBE_LEGACY_MBR;
+        if (
+            STATUS_SUCCESS != results[i].status
+         || expected != results[i].probe)
+        {
+            ++wrong;
+        }
+    }
+
+    TEST_EXPECT(0 == wrong);
+}
+
+/**
+ * Scanning no images succeeds.
+ */
+TEST(gpt_scan_images_empty)
+{
+    gpt_scan_result result;
+
+    TEST_EXPECT(STATUS_SUCCESS == gpt_scan_images(&result, nullptr, 0, 0));
+}
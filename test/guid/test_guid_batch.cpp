@@ -0,0 +1,208 @@
+/**
+ * \file test/guid/test_guid_batch.cpp
+ *
+ * \brief Unit tests for the batch guid conversions.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+#include "../test_pattern.h"
+
+FAT32_IMPORT_guid;
+
+TEST_SUITE(guid_batch);
+
+#define COUNT 128
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x31415926
+
+/**
+ * Batch binary and string conversions match the single conversions and round
+ * trip.
+ */
+TEST(guid_batch_round_trip)
+{
+    static uint8_t data[COUNT * FAT32_GUID_BINARY_SIZE];
+    static uint8_t binary[COUNT * FAT32_GUID_BINARY_SIZE];
+    static char strings[COUNT * FAT32_GUID_STRING_SIZE];
+    guid ids[COUNT];
+    guid parsed[COUNT];
+    size_t failed_index = 0;
+
+    fill_pattern(data, sizeof(data), PATTERN_SEED);
+
+    /* binary to guid. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_init_from_data_n(
+                    ids, COUNT, data, sizeof(data), &failed_index));
+    TEST_EXPECT(COUNT == failed_index);
+
+    /* guid to string. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_write_to_string_n(
+                    strings, sizeof(strings), ids, COUNT, &failed_index));
+    TEST_EXPECT(COUNT == failed_index);
+
+    /* string to guid. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_init_from_string_n(
+                    parsed, COUNT, strings, sizeof(strings), &failed_index));
+    TEST_EXPECT(COUNT == failed_index);
+
+    /* guid to binary. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_write_to_binary_n(
+                    binary, sizeof(binary), parsed, COUNT, &failed_index));
+    TEST_EXPECT(COUNT == failed_index);
+    TEST_EXPECT(0 == memcmp(data, binary, sizeof(data)));
+
+    /* each element matches the single conversions. */
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        guid id;
+        char str[FAT32_GUID_STRING_SIZE];
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == guid_init_from_data(
+                        &id, data + i * FAT32_GUID_BINARY_SIZE,
+                        FAT32_GUID_BINARY_SIZE));
+        TEST_EXPECT(0 == memcmp(&id, ids + i, sizeof(id)));
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == guid_write_to_string(str, sizeof(str), &id));
+        TEST_EXPECT(
+            0 == strcmp(str, strings + i * FAT32_GUID_STRING_SIZE));
+    }
+}
+
+/**
+ * Binary conversions require exactly count guids of data.
+ */
+TEST(guid_batch_binary_bad_size)
+{
+    uint8_t data[3 * FAT32_GUID_BINARY_SIZE] = { 0 };
+    guid ids[3];
+    size_t failed_index = 99;
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_DATA_INVALID_SIZE
+            == guid_init_from_data_n(
+                    ids, 3, data, sizeof(data) - 1, &failed_index));
+    TEST_EXPECT(0 == failed_index);
+
+    failed_index = 99;
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_DATA_INVALID_SIZE
+            == guid_write_to_binary_n(
+                    data, sizeof(data), ids, 2, &failed_index));
+    TEST_EXPECT(0 == failed_index);
+}
+
+/**
+ * String writes require room for every string.
+ */
+TEST(guid_batch_write_to_string_too_small)
+{
+    char strings[2 * FAT32_GUID_STRING_SIZE];
+    guid ids[2];
+    size_t failed_index = 99;
+
+    memset(ids, 0, sizeof(ids));
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_STRING_BAD
+            == guid_write_to_string_n(
+                    strings, sizeof(strings) - 1, ids, 2, &failed_index));
+    TEST_EXPECT(0 == failed_index);
+}
+
+/**
+ * String parsing reports the first bad string, and initializes the guids
+ * before it.
+ */
+TEST(guid_batch_init_from_string_first_failure)
+{
+    char strings[4 * FAT32_GUID_STRING_SIZE];
+    guid ids[4];
+    guid expected;
+    size_t failed_index = 99;
+
+    memset(strings, 0, sizeof(strings));
+    strcpy(strings, "c8668d03-e2ee-43f0-9c58-c373b2005b18");
+    strcpy(
+        strings + FAT32_GUID_STRING_SIZE,
+        "c8668d03 e2ee 43f0 9c58 c373b2005b18");
+    strcpy(
+        strings + 2 * FAT32_GUID_STRING_SIZE,
+        "c8668d03-e2ee-43f0-9c58-c373b2005b1");
+    strcpy(
+        strings + 3 * FAT32_GUID_STRING_SIZE,
+        "c8668d03-e2ee-43f0-9c58-c373b2005b18");
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_init_from_string(
+                    &expected, "c8668d03-e2ee-43f0-9c58-c373b2005b18"));
+
+    /* the third string is missing a digit. */
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_STRING_BAD
+            == guid_init_from_string_n(
+                    ids, 4, strings, sizeof(strings), &failed_index));
+    TEST_EXPECT(2 == failed_index);
+    TEST_EXPECT(0 == memcmp(&expected, ids + 0, sizeof(expected)));
+    TEST_EXPECT(0 == memcmp(&expected, ids + 1, sizeof(expected)));
+}
+
+/**
+ * String parsing reports a string that isn't terminated in its slot.
+ */
+TEST(guid_batch_init_from_string_unterminated)
+{
+    char strings[2 * FAT32_GUID_STRING_SIZE];
+    guid ids[2];
+    size_t failed_index = 99;
+
+    memset(strings, 'a', sizeof(strings));
+    strings[sizeof(strings) - 1] = 0;
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_STRING_BAD
+            == guid_init_from_string_n(
+                    ids, 2, strings, sizeof(strings), &failed_index));
+    TEST_EXPECT(0 == failed_index);
+}
+
+/**
+ * String parsing reports a slot that lies outside of the buffer.
+ */
+TEST(guid_batch_init_from_string_short_buffer)
+{
+    char strings[2 * FAT32_GUID_STRING_SIZE];
+    guid ids[2];
+    size_t failed_index = 99;
+
+    memset(strings, 0, sizeof(strings));
+    strcpy(strings, "c8668d03-e2ee-43f0-9c58-c373b2005b18");
+    strcpy(
+        strings + FAT32_GUID_STRING_SIZE,
+        "c8668d03-e2ee-43f0-9c58-c373b2005b18");
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_STRING_BAD
+            == guid_init_from_string_n(
+                    ids, 2, strings, sizeof(strings) - 1, &failed_index));
+    TEST_EXPECT(1 == failed_index);
+}
@@ -0,0 +1,76 @@
+/**
+ * \file test/guid/test_guid_constexpr.cpp
+ *
+ * \brief Unit tests for the compile-time guid parser.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/fat32.hpp>
+#include <minunit/minunit.h>
+#include <string.h>
+
+FAT32_IMPORT_guid;
+
+using namespace fat32::literals;
+
+TEST_SUITE(guid_constexpr);
+
+/* the EFI system partition type guid, parsed at compile time. */
+static constexpr fat32::guid efi_system =
+    "C12A7328-F81F-11D2-BA4B-00A0C93EC93B"_guid;
+
+static_assert(0xC12A7328 == efi_system.data1);
+static_assert(0xF81F == efi_system.data2);
+static_assert(0x11D2 == efi_system.data3);
+static_assert(0xBA == efi_system.data4[0]);
+static_assert(0x3B == efi_system.data4[7]);
+
+/**
+ * \brief Check a string with both the compile-time and the C parser.
+ */
+static bool parsers_agree(const char* str)
+{
+    fat32::guid cpp_id{};
+    guid c_id{};
+
+    int cpp_status = fat32::guid_init_from_string(cpp_id, str);
+    int c_status = guid_init_from_string(&c_id, str);
+
+    if (cpp_status != c_status)
+    {
+        return false;
+    }
+
+    return
+        STATUS_SUCCESS != c_status
+     || 0 == memcmp(&cpp_id, &c_id, sizeof(c_id));
+}
+
+/**
+ * The compile-time parser accepts and rejects the same strings as the C parser,
+ * and produces the same guids.
+ */
+TEST(guid_constexpr_matches_c_parser)
+{
+    TEST_EXPECT(parsers_agree("C12A7328-F81F-11D2-BA4B-00A0C93EC93B"));
+    TEST_EXPECT(parsers_agree("c12a7328-f81f-11d2-ba4b-00a0c93ec93b"));
+    TEST_EXPECT(parsers_agree("{C12A7328F81F11D2BA4B00A0C93EC93B}"));
+    TEST_EXPECT(parsers_agree("C12A7328-F81F-11D2-BA4B-00A0C93EC93"));
+    TEST_EXPECT(parsers_agree("C12A7328-F81F-11D2-BA4B-00A0C93EC93B0"));
+    TEST_EXPECT(parsers_agree("C12A7328-F81F-11D2-BA4B-00A0C93EC93G"));
+    TEST_EXPECT(parsers_agree(""));
+}
+
+/**
+ * An invalid string is rejected.
+ */
+TEST(guid_constexpr_bad_string)
+{
+    fat32::guid id{};
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_STRING_BAD
+            == fat32::guid_init_from_string(id, "not a guid"));
+}
@@ -0,0 +1,91 @@
+/**
+ * \file test/guid/test_guid_format.cpp
+ *
+ * \brief Unit tests for the guid string formatters.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/guid/guid_internal.h"
+#include "../test_pattern.h"
+
+FAT32_IMPORT_guid;
+
+TEST_SUITE(guid_format);
+
+/**
+ * \brief Format a guid with printf as a reference.
+ */
+static void reference_format(char* str, const guid* id)
+{
+    snprintf(
+        str, FAT32_GUID_STRING_SIZE,
+        "%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x",
+        (unsigned int)id->data1, id->data2, id->data3,
+        id->data4[0], id->data4[1], id->data4[2], id->data4[3],
+        id->data4[4], id->data4[5], id->data4[6], id->data4[7]);
+}
+
+/**
+ * guid_write_to_string matches printf for many guids.
+ */
+TEST(guid_write_to_string_matches_reference)
+{
+    const uint32_t seed = 0x0badcafe;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        guid id;
+        char expected[FAT32_GUID_STRING_SIZE];
+        char actual[FAT32_GUID_STRING_SIZE];
+
+        fill_pattern((uint8_t*)&id, sizeof(id), seed + i);
+        reference_format(expected, &id);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == guid_write_to_string(actual, sizeof(actual), &id));
+        TEST_EXPECT(0 == strcmp(expected, actual));
+    }
+}
+
+#if defined(__x86_64__)
+/**
+ * The SSSE3 formatter matches printf for many guids, and writes exactly
+ * FAT32_GUID_STRING_SIZE bytes.
+ */
+TEST(guid_format_ssse3_matches_reference)
+{
+    const uint32_t seed = 0x600dd00d;
+
+    /* skip this test on hosts without SSSE3. */
+    if (!(FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3))
+    {
+        return;
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        guid id;
+        char expected[FAT32_GUID_STRING_SIZE];
+        char actual[FAT32_GUID_STRING_SIZE + 1];
+
+        fill_pattern((uint8_t*)&id, sizeof(id), seed + i);
+        reference_format(expected, &id);
+
+        actual[FAT32_GUID_STRING_SIZE] = 'x';
+        FAT32_SYM(guid_format_ssse3)(actual, &id);
+
+        TEST_EXPECT(0 == strcmp(expected, actual));
+        TEST_EXPECT('x' == actual[FAT32_GUID_STRING_SIZE]);
+    }
+}
+#endif
@@ -0,0 +1,186 @@
+/**
+ * \file test/guid/test_guid_generate.cpp
+ *
+ * \brief Unit tests for random guid generation.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <algorithm>
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../src/guid/guid_internal.h"
+
+FAT32_IMPORT_guid;
+
+TEST_SUITE(guid_generate);
+
+/**
+ * \brief Order guids by their bytes.
+ */
+static bool guid_less(const guid& lhs, const guid& rhs)
+{
+    return memcmp(&lhs, &rhs, sizeof(guid)) < 0;
+}
+
+/**
+ * \brief Return true if two guids are identical.
+ */
+static bool guid_same(const guid& lhs, const guid& rhs)
+{
+    return 0 == memcmp(&lhs, &rhs, sizeof(guid));
+}
+
+/**
+ * The ChaCha20 block function matches RFC 8439, section 2.3.2.
+ */
+TEST(guid_chacha20_block_rfc8439)
+{
+    const uint32_t key[8] = {
+        0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c,
+        0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c };
+    const uint32_t nonce[3] = { 0x09000000, 0x4a000000, 0x00000000 };
+    const uint32_t expected[16] = {
+        0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3,
+        0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3,
+        0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9,
+        0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2 };
+    uint32_t out[16];
+
+    FAT32_SYM(guid_chacha20_block)(out, key, 1, nonce);
+
+    TEST_EXPECT(0 == memcmp(expected, out, sizeof(out)));
+}
+
+/**
+ * Generated guids have the version 4 and variant 1 bits, and are unique.
+ */
+TEST(guid_generate_v4_n_version_and_unique)
+{
+    std::vector<guid> ids(4096);
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_generate_v4_n(ids.data(), ids.size()));
+
+    for (const guid& id : ids)
+    {
+        TEST_EXPECT(0x4000 == (id.data3 & 0xf000));
+        TEST_EXPECT(0x80 == (id.data4[0] & 0xc0));
+    }
+
+    std::sort(ids.begin(), ids.end(), guid_less);
+    TEST_EXPECT(
+        ids.end() == std::adjacent_find(ids.begin(), ids.end(), guid_same));
+}
+
+/**
+ * A single generated guid round trips through its string form as version 4.
+ */
+TEST(guid_generate_v4_string)
+{
+    guid id;
+    char str[FAT32_GUID_STRING_SIZE];
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_generate_v4(&id));
+    TEST_ASSERT(STATUS_SUCCESS == guid_write_to_string(str, sizeof(str), &id));
+
+    TEST_EXPECT('4' == str[14]);
+    TEST_EXPECT(nullptr != strchr("89ab", str[19]));
+}
+
+/**
+ * Generating no guids succeeds.
+ */
+TEST(guid_generate_v4_n_empty)
+{
+    guid id;
+
+    TEST_EXPECT(STATUS_SUCCESS == guid_generate_v4_n(&id, 0));
+}
+
+/**
+ * \brief Generate a guid on another thread.
+ */
+static void* generate_thread(void* context)
+{
+    guid* id = (guid*)context;
+
+    if (STATUS_SUCCESS != guid_generate_v4(id))
+    {
+        memset(id, 0, sizeof(*id));
+    }
+
+    return nullptr;
+}
+
+/**
+ * Threads don't share a generator sequence.
+ */
+TEST(guid_generate_v4_threads_differ)
+{
+    guid ids[3];
+    pthread_t threads[2];
+
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == pthread_create(
+                        threads + i, nullptr, &generate_thread, ids + i));
+    }
+
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(0 == pthread_join(threads[i], nullptr));
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_generate_v4(ids + 2));
+
+    TEST_EXPECT(!guid_same(ids[0], ids[1]));
+    TEST_EXPECT(!guid_same(ids[0], ids[2]));
+    TEST_EXPECT(!guid_same(ids[1], ids[2]));
+}
+
+/**
+ * A child process doesn't repeat the parent's sequence after fork.
+ */
+TEST(guid_generate_v4_fork_differs)
+{
+    guid seeded, parent, child;
+    int fds[2];
+
+    /* seed this thread's generator before forking. */
+    TEST_ASSERT(STATUS_SUCCESS == guid_generate_v4(&seeded));
+    TEST_ASSERT(0 == pipe(fds));
+
+    pid_t pid = fork();
+    TEST_ASSERT(pid >= 0);
+    if (0 == pid)
+    {
+        guid id;
+        int status = guid_generate_v4(&id);
+        ssize_t written =
+            STATUS_SUCCESS == status ? write(fds[1], &id, sizeof(id)) : -1;
+
+        _exit(sizeof(id) == written ? 0 : 1);
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_generate_v4(&parent));
+    TEST_ASSERT(sizeof(child) == read(fds[0], &child, sizeof(child)));
+
+    int status = 0;
+    TEST_ASSERT(pid == waitpid(pid, &status, 0));
+    TEST_EXPECT(WIFEXITED(status) && 0 == WEXITSTATUS(status));
+
+    close(fds[0]);
+    close(fds[1]);
+
+    TEST_EXPECT(!guid_same(parent, child));
+}
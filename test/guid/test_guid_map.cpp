@@ -0,0 +1,298 @@
+/**
+ * \file test/guid/test_guid_map.cpp
+ *
+ * \brief Unit tests for guid equality, ordering, hashing, and the guid map.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <algorithm>
+#include <libfat32/fat32.hpp>
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <set>
+#include <string.h>
+#include <unordered_set>
+#include <vector>
+
+#include "../test_pattern.h"
+
+FAT32_IMPORT_guid;
+
+using namespace fat32::literals;
+
+TEST_SUITE(guid_map);
+
+/* The seed of the test pattern of this file. */
+#define PATTERN_SEED                                               0x2545f491
+
+/**
+ * \brief Build a guid from a counter, varying only the low bytes of data4 as
+ * sequential guids do.
+ */
+static guid sequential_guid(uint32_t n)
+{
+    guid id = "c12a7328-f81f-11d2-ba4b-00a0c93ec93b"_guid;
+
+    id.data4[4] = (uint8_t)(n >> 24);
+    id.data4[5] = (uint8_t)(n >> 16);
+    id.data4[6] = (uint8_t)(n >> 8);
+    id.data4[7] = (uint8_t)n;
+
+    return id;
+}
+
+/**
+ * guid_equal and guid_compare agree with field-by-field comparison.
+ */
+TEST(guid_equal_and_compare)
+{
+    guid a = "00000001-0000-0000-0000-000000000000"_guid;
+    guid b = "00000000-ffff-ffff-ffff-ffffffffffff"_guid;
+    guid c = "00000000-ffff-ffff-ffff-fffffffffffe"_guid;
+    guid d = "00000000-ffff-ffff-7fff-ffffffffffff"_guid;
+
+    TEST_EXPECT(guid_equal(&a, &a));
+    TEST_EXPECT(!guid_equal(&a, &b));
+    TEST_EXPECT(0 == guid_compare(&a, &a));
+
+    /* data1 decides before the other fields. */
+    TEST_EXPECT(guid_compare(&b, &a) < 0);
+    TEST_EXPECT(guid_compare(&a, &b) > 0);
+
+    /* data4 is compared in byte order. */
+    TEST_EXPECT(guid_compare(&c, &b) < 0);
+    TEST_EXPECT(guid_compare(&d, &c) < 0);
+}
+
+/**
+ * guid_compare orders guids as their canonical strings.
+ */
+TEST(guid_compare_matches_string_order)
+{
+    std::vector<guid> ids(200);
+
+    fill_pattern(
+        (uint8_t*)ids.data(), ids.size() * sizeof(guid), PATTERN_SEED);
+
+    std::sort(
+        ids.begin(), ids.end(),
+        [](const guid& lhs, const guid& rhs) {
+            return guid_compare(&lhs, &rhs) < 0; });
+
+    for (size_t i = 1; i < ids.size(); ++i)
+    {
+        char lhs[FAT32_GUID_STRING_SIZE], rhs[FAT32_GUID_STRING_SIZE];
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == guid_write_to_string(lhs, sizeof(lhs), &ids[i - 1]));
+        TEST_ASSERT(
+            STATUS_SUCCESS == guid_write_to_string(rhs, sizeof(rhs), &ids[i]));
+        TEST_EXPECT(strcmp(lhs, rhs) <= 0);
+
+        /* the C++ operators agree. */
+        TEST_EXPECT(ids[i - 1] <= ids[i]);
+        TEST_EXPECT((ids[i - 1] == ids[i]) == guid_equal(&ids[i - 1], &ids[i]));
+    }
+}
+
+/**
+ * guid_hash is fixed across hosts, and spreads sequential guids.
+ */
+TEST(guid_hash_values)
+{
+    guid esp = "c12a7328-f81f-11d2-ba4b-00a0c93ec93b"_guid;
+    std::unordered_set<uint64_t> buckets;
+
+    TEST_EXPECT(0xb13ef17d4d52cd5aULL == guid_hash(&esp));
+
+    /* sequential guids land in distinct buckets of a small table. */
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        guid id = sequential_guid(i);
+        buckets.insert(guid_hash(&id) & 0xfff);
+    }
+
+    TEST_EXPECT(buckets.size() >= 62);
+}
+
+/**
+ * The C++ operators work at compile time, and std::hash uses guid_hash.
+ */
+TEST(guid_cpp_operators)
+{
+    static_assert(
+        "c12a7328-f81f-11d2-ba4b-00a0c93ec93b"_guid
+            == "C12A7328-F81F-11D2-BA4B-00A0C93EC93B"_guid);
+    static_assert(
+        "c12a7328-f81f-11d2-ba4b-00a0c93ec93b"_guid
+            < "c12a7328-f81f-11d2-ba4b-00a0c93ec93c"_guid);
+
+    guid id = "c12a7328-f81f-11d2-ba4b-00a0c93ec93b"_guid;
+    TEST_EXPECT((size_t)guid_hash(&id) == std::hash<guid>{}(id));
+}
+
+/**
+ * Capacities must be non-zero powers of two.
+ */
+TEST(guid_map_init_bad_capacity)
+{
+    guid_map_entry entries[6];
+    guid_map map;
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_MAP_BAD_CAPACITY == guid_map_init(&map, entries, 6));
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_MAP_BAD_CAPACITY == guid_map_init(&map, entries, 0));
+    TEST_EXPECT(STATUS_SUCCESS == guid_map_init(&map, entries, 4));
+}
+
+/**
+ * Inserted guids are found with their values, duplicates are rejected, and
+ * the map fills at 7/8 of its capacity.
+ */
+TEST(guid_map_insert_find)
+{
+    guid_map_entry entries[64];
+    guid_map map;
+    int values[64];
+    void* value = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_map_init(&map, entries, 64));
+
+    for (uint32_t i = 0; i < 56; ++i)
+    {
+        guid id = sequential_guid(i);
+        TEST_ASSERT(STATUS_SUCCESS == guid_map_insert(&map, &id, values + i));
+    }
+
+    TEST_EXPECT(56 == map.count);
+
+    guid extra = sequential_guid(56);
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_MAP_FULL == guid_map_insert(&map, &extra, values));
+
+    guid dup = sequential_guid(3);
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_MAP_DUPLICATE == guid_map_insert(&map, &dup, values));
+
+    for (uint32_t i = 0; i < 56; ++i)
+    {
+        guid id = sequential_guid(i);
+        TEST_ASSERT(STATUS_SUCCESS == guid_map_find(&value, &map, &id));
+        TEST_EXPECT(values + i == value);
+    }
+
+    TEST_EXPECT(
+        FAT32_ERROR_GUID_MAP_NOT_FOUND == guid_map_find(&value, &map, &extra));
+}
+
+/**
+ * Removing guids keeps every other guid reachable, in a small map where
+ * probe runs wrap around and overlap.
+ */
+TEST(guid_map_remove_keeps_runs)
+{
+    guid_map_entry entries[8];
+    guid_map map;
+    int values[7];
+    void* value = nullptr;
+
+    for (uint32_t victim = 0; victim < 7; ++victim)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == guid_map_init(&map, entries, 8));
+
+        for (uint32_t i = 0; i < 7; ++i)
+        {
+            guid id = sequential_guid(i);
+            TEST_ASSERT(
+                STATUS_SUCCESS == guid_map_insert(&map, &id, values + i));
+        }
+
+        guid removed = sequential_guid(victim);
+        TEST_ASSERT(STATUS_SUCCESS == guid_map_remove(&map, &removed));
+        TEST_EXPECT(
+            FAT32_ERROR_GUID_MAP_NOT_FOUND == guid_map_remove(&map, &removed));
+        TEST_EXPECT(6 == map.count);
+
+        for (uint32_t i = 0; i < 7; ++i)
+        {
+            guid id = sequential_guid(i);
+            int status = guid_map_find(&value, &map, &id);
+
+            if (victim == i)
+            {
+                TEST_EXPECT(FAT32_ERROR_GUID_MAP_NOT_FOUND == status);
+            }
+            else
+            {
+                TEST_EXPECT(STATUS_SUCCESS == status);
+                TEST_EXPECT(values + i == value);
+            }
+        }
+
+        /* the freed slot can be reused. */
+        TEST_EXPECT(STATUS_SUCCESS == guid_map_insert(&map, &removed, values));
+    }
+}
+
+/**
+ * The map matches std::set over a long run of random inserts and removes.
+ */
+TEST(guid_map_matches_set)
+{
+    static guid_map_entry entries[256];
+    guid_map map;
+    std::set<guid> expected;
+    uint32_t state = 0x7fb5d329;
+    void* value = nullptr;
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_map_init(&map, entries, 256));
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        guid id = sequential_guid((state >> 16) % 300);
+        bool present = expected.count(id) > 0;
+
+        if (state & 0x80000000)
+        {
+            int status = guid_map_insert(&map, &id, nullptr);
+            if (present)
+            {
+                TEST_EXPECT(FAT32_ERROR_GUID_MAP_DUPLICATE == status);
+            }
+            else if (STATUS_SUCCESS == status)
+            {
+                expected.insert(id);
+            }
+            else
+            {
+                TEST_EXPECT(FAT32_ERROR_GUID_MAP_FULL == status);
+                TEST_EXPECT(224 == expected.size());
+            }
+        }
+        else
+        {
+            TEST_EXPECT(
+                (present ? STATUS_SUCCESS : FAT32_ERROR_GUID_MAP_NOT_FOUND)
+                    == guid_map_remove(&map, &id));
+            expected.erase(id);
+        }
+
+        TEST_ASSERT(expected.size() == map.count);
+    }
+
+    for (uint32_t n = 0; n < 300; ++n)
+    {
+        guid id = sequential_guid(n);
+
+        TEST_EXPECT(
+            (expected.count(id) ? STATUS_SUCCESS
+                                : FAT32_ERROR_GUID_MAP_NOT_FOUND)
+                == guid_map_find(&value, &map, &id));
+    }
+}
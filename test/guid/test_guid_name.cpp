@@ -0,0 +1,104 @@
+/**
+ * \file test/guid/test_guid_name.cpp
+ *
+ * \brief Unit tests for name-based guids.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <string>
+
+#include "../../src/guid/guid_internal.h"
+
+FAT32_IMPORT_guid;
+
+TEST_SUITE(guid_name);
+
+/**
+ * \brief Derive a name-based guid and return it in string form.
+ */
+static std::string name_guid(const char* ns_str, const void* name, size_t size)
+{
+    guid ns, id;
+    char str[FAT32_GUID_STRING_SIZE];
+
+    if (STATUS_SUCCESS != guid_init_from_string(&ns, ns_str)
+     || STATUS_SUCCESS != guid_init_from_name(&id, &ns, name, size)
+     || STATUS_SUCCESS != guid_write_to_string(str, sizeof(str), &id))
+    {
+        return "";
+    }
+
+    return str;
+}
+
+/**
+ * SHA-1 matches the FIPS 180-4 examples, including a two block message.
+ */
+TEST(guid_sha1_fips180_examples)
+{
+    const uint8_t abc[20] = {
+        0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e,
+        0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d };
+    const uint8_t two_block[20] = {
+        0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae,
+        0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5, 0xe5, 0x46, 0x70, 0xf1 };
+    const char* message =
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    uint8_t digest[20];
+
+    /* the split between prefix and data doesn't matter. */
+    FAT32_SYM(guid_sha1)(digest, "a", 1, "bc", 2);
+    TEST_EXPECT(0 == memcmp(abc, digest, sizeof(digest)));
+
+    FAT32_SYM(guid_sha1)(digest, message, 16, message + 16, 40);
+    TEST_EXPECT(0 == memcmp(two_block, digest, sizeof(digest)));
+}
+
+/**
+ * Name-based guids match the version 5 guids of other implementations.
+ */
+TEST(guid_init_from_name_reference)
+{
+    std::string key;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        key += "build-key";
+    }
+
+    TEST_EXPECT(
+        "2ed6657d-e927-568b-95e1-2665a8aea6a2"
+            == name_guid(
+                    "6ba7b810-9dad-11d1-80b4-00c04fd430c8",
+                    "www.example.com", 15));
+
+    TEST_EXPECT(
+        "1b4db7eb-4057-5ddf-91e0-36dec72071f5"
+            == name_guid("6ba7b811-9dad-11d1-80b4-00c04fd430c8", "", 0));
+
+    /* a name spanning several SHA-1 blocks. */
+    TEST_EXPECT(
+        "f19c3442-b9d9-515f-a589-3992305e555c"
+            == name_guid(
+                    "0fc63daf-8483-4772-8e79-3d69d8477de4",
+                    key.data(), key.size()));
+}
+
+/**
+ * Name-based guids depend on both the namespace and the name.
+ */
+TEST(guid_init_from_name_distinct)
+{
+    const char* ns1 = "6ba7b810-9dad-11d1-80b4-00c04fd430c8";
+    const char* ns2 = "6ba7b811-9dad-11d1-80b4-00c04fd430c8";
+
+    TEST_EXPECT(name_guid(ns1, "disk", 4) == name_guid(ns1, "disk", 4));
+    TEST_EXPECT(name_guid(ns1, "disk", 4) != name_guid(ns2, "disk", 4));
+    TEST_EXPECT(name_guid(ns1, "disk", 4) != name_guid(ns1, "disk1", 5));
+}
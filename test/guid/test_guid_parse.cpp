@@ -0,0 +1,136 @@
+/**
+ * \file test/guid/test_guid_parse.cpp
+ *
+ * \brief Unit tests for the canonical guid string parser.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <ctype.h>
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+#include "../../src/cpu/cpu_internal.h"
+#include "../../src/guid/guid_internal.h"
+
+FAT32_IMPORT_guid;
+
+TEST_SUITE(guid_parse);
+
+static const char* CANONICAL = "0fC63DaF-8483-4772-8e79-3D69d8477DE4";
+
+/**
+ * Canonical strings parse the same as the same digits in a form that only the
+ * tolerant parser accepts.
+ */
+TEST(guid_init_from_string_canonical_matches_tolerant)
+{
+    guid canonical;
+    guid tolerant;
+
+    TEST_ASSERT(STATUS_SUCCESS == guid_init_from_string(&canonical, CANONICAL));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_init_from_string(
+                    &tolerant, "{0fc63daf 8483 4772 8E79 3d69D8477de4}"));
+
+    TEST_EXPECT(0 == memcmp(&canonical, &tolerant, sizeof(canonical)));
+    TEST_EXPECT(0x0fc63daf == canonical.data1);
+    TEST_EXPECT(0x8483 == canonical.data2);
+    TEST_EXPECT(0x4772 == canonical.data3);
+    TEST_EXPECT(0x8e == canonical.data4[0]);
+    TEST_EXPECT(0xe4 == canonical.data4[7]);
+}
+
+/**
+ * A canonical-length string with a non-hex character in place of a digit is
+ * rejected, and one in place of a separator still falls back to the tolerant
+ * parser.
+ */
+TEST(guid_init_from_string_canonical_length_corruption)
+{
+    guid expected;
+    TEST_ASSERT(STATUS_SUCCESS == guid_init_from_string(&expected, CANONICAL));
+
+    for (size_t i = 0; i < FAT32_GUID_CANONICAL_LENGTH; ++i)
+    {
+        char str[FAT32_GUID_STRING_SIZE];
+        bool separator = '-' == CANONICAL[i];
+        guid id;
+
+        memcpy(str, CANONICAL, sizeof(str));
+        str[i] = 'g';
+        memset(&id, 0, sizeof(id));
+
+        int retval = guid_init_from_string(&id, str);
+        if (separator)
+        {
+            TEST_EXPECT(STATUS_SUCCESS == retval);
+            TEST_EXPECT(0 == memcmp(&expected, &id, sizeof(id)));
+        }
+        else
+        {
+            TEST_EXPECT(FAT32_ERROR_GUID_STRING_BAD == retval);
+        }
+    }
+}
+
+#if defined(__x86_64__)
+/**
+ * The SSSE3 parser accepts exactly the hex digits at each digit position and
+ * only a dash at each separator position.
+ */
+TEST(guid_parse_canonical_ssse3_every_byte)
+{
+    /* skip this test on hosts without SSSE3. */
+    if (!(FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < FAT32_GUID_CANONICAL_LENGTH; ++i)
+    {
+        for (int ch = 1; ch < 256; ++ch)
+        {
+            char str[FAT32_GUID_STRING_SIZE];
+            bool separator = '-' == CANONICAL[i];
+            guid id;
+
+            memcpy(str, CANONICAL, sizeof(str));
+            str[i] = (char)ch;
+
+            bool accepted = FAT32_SYM(guid_parse_canonical_ssse3)(&id, str);
+            bool expected = separator ? '-' == ch : 0 != isxdigit(ch);
+
+            TEST_EXPECT(expected == accepted);
+        }
+    }
+}
+
+/**
+ * The SSSE3 parser leaves the guid untouched when it rejects a string.
+ */
+TEST(guid_parse_canonical_ssse3_no_write_on_failure)
+{
+    guid id;
+
+    /* skip this test on hosts without SSSE3. */
+    if (!(FAT32_SYM(cpu_features)() & FAT32_CPU_FEATURE_SSSE3))
+    {
+        return;
+    }
+
+    memset(&id, 0xa5, sizeof(id));
+
+    TEST_EXPECT(
+        !FAT32_SYM(guid_parse_canonical_ssse3)(
+            &id, "0fc63daf-8483-4772-8e79+3d69d8477de4"));
+    for (size_t i = 0; i < sizeof(id); ++i)
+    {
+        TEST_EXPECT(0xa5 == ((const uint8_t*)&id)[i]);
+    }
+}
+#endif
@@ -0,0 +1,159 @@
+/**
+ * \file test/guid/test_guid_raw.cpp
+ *
+ * \brief Unit tests for matching guids in their on-disk form.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libfat32/fat32.hpp>
+#include <libfat32/guid.h>
+#include <libfat32/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
+
+FAT32_IMPORT_guid;
+
+using namespace fat32::literals;
+
+TEST_SUITE(guid_raw);
+
+/* The size of a GPT partition entry. */
+#define ENTRY_SIZE                                                        128
+
+/**
+ * \brief Build an entry array where entry i has a guid that differs from the
+ * target only in its last byte, and write the target at the given indices.
+ */
+static std::vector<uint8_t> entry_array(
+    const guid& target, size_t count, const std::vector<size_t>& matches)
+{
+    std::vector<uint8_t> entries(count * ENTRY_SIZE, 0xa5);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        guid id = target;
+        id.data4[7] ^= (uint8_t)(i + 1);
+
+        if (
+            STATUS_SUCCESS
+                != guid_write_to_binary(
+                        entries.data() + i * ENTRY_SIZE,
+                        FAT32_GUID_BINARY_SIZE, &id))
+        {
+            entries.clear();
+            return entries;
+        }
+    }
+
+    for (size_t i : matches)
+    {
+        if (
+            STATUS_SUCCESS
+                != guid_write_to_binary(
+                        entries.data() + i * ENTRY_SIZE,
+                        FAT32_GUID_BINARY_SIZE, &target))
+        {
+            entries.clear();
+            return entries;
+        }
+    }
+
+    return entries;
+}
+
+/**
+ * A raw guid matches exactly when the decoded guid is equal.
+ */
+TEST(guid_match_raw_agrees_with_decode)
+{
+    guid target = "c12a7328-f81f-11d2-ba4b-00a0c93ec93b"_guid;
+    uint8_t raw[FAT32_GUID_BINARY_SIZE];
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == guid_write_to_binary(raw, sizeof(raw), &target));
+    TEST_EXPECT(guid_match_raw(raw, &target));
+
+    /* a change to any byte is a mismatch. */
+    for (size_t i = 0; i < sizeof(raw); ++i)
+    {
+        guid decoded;
+
+        raw[i] ^= 0x01;
+        TEST_ASSERT(
+            STATUS_SUCCESS == guid_init_from_data(&decoded, raw, sizeof(raw)));
+        TEST_EXPECT(!guid_match_raw(raw, &target));
+        TEST_EXPECT(!guid_equal(&decoded, &target));
+        raw[i] ^= 0x01;
+    }
+}
+
+/**
+ * The scan finds the first match wherever it is, including in the tail.
+ */
+TEST(guid_find_raw_first_match)
+{
+    guid target = "0fc63daf-8483-4772-8e79-3d69d8477de4"_guid;
+
+    for (size_t count = 1; count <= 13; ++count)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            std::vector<uint8_t> entries =
+                entry_array(target, count, { index, count - 1 });
+            TEST_ASSERT(!entries.empty());
+
+            TEST_EXPECT(
+                index
+                    == guid_find_raw(
+                            entries.data(), ENTRY_SIZE, count, &target));
+        }
+    }
+}
+
+/**
+ * The scan returns the count when no entry matches.
+ */
+TEST(guid_find_raw_no_match)
+{
+    guid target = "0fc63daf-8483-4772-8e79-3d69d8477de4"_guid;
+
+    for (size_t count = 0; count <= 13; ++count)
+    {
+        std::vector<uint8_t> entries = entry_array(target, count + 1, { });
+        TEST_ASSERT(!entries.empty());
+
+        TEST_EXPECT(
+            count
+                == guid_find_raw(entries.data(), ENTRY_SIZE, count, &target));
+    }
+}
+
+/**
+ * Records packed at the minimum stride are scanned like any other array.
+ */
+TEST(guid_find_raw_packed)
+{
+    guid target = "e3c9e316-0b5c-4db8-817d-f92df00215ae"_guid;
+    std::vector<guid> ids(9, target);
+    std::vector<uint8_t> raw(ids.size() * FAT32_GUID_BINARY_SIZE);
+    size_t failed_index;
+
+    for (size_t i = 0; i + 1 < ids.size(); ++i)
+    {
+        ids[i].data1 += (uint32_t)(i + 1);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == guid_write_to_binary_n(
+                    raw.data(), raw.size(), ids.data(), ids.size(),
+                    &failed_index));
+
+    TEST_EXPECT(
+        ids.size() - 1
+            == guid_find_raw(
+                    raw.data(), FAT32_GUID_BINARY_SIZE, ids.size(), &target));
+}
@@ -0,0 +1,34 @@
+/**
+ * \file test/test_pattern.h
+ *
+ * \brief Deterministic test data shared by the unit tests.
+ *
+ * \copyright 2025 Justin Handville.  Please see LICENSE.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * \brief Fill a buffer with a deterministic pseudo-random pattern.
+ *
+ * \note Each test file uses its own seed, so that files don't all test the
+ * same bytes.
+ *
+ * \param buffer            The buffer to fill.
+ * \param size              The size of the buffer.
+ * \param seed              The starting state of the generator.
+ */
+static inline void fill_pattern(uint8_t* buffer, size_t size, uint32_t seed)
+{
+    uint32_t state = seed;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        buffer[i] = (uint8_t)(state >> 16);
+    }
+}
@@ -0,0 +1,363 @@
+/**
+ * \file gpt_scan/main.c
+ *
+ * \brief Classify a list of raw disk images and summarize their partitions.
+ *
+ * \note Paths are taken from the command line, or one per line from standard
+ * input if none are given, so that a cache can be audited with
+ * find ... | gpt_scan. One tab-separated line is written per image, and a
+ * summary of the classes is written to standard error.
+ *
+ * \copyright 2025 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <errno.h>
+#include <libfat32/gpt.h>
+#include <libfat32/status.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+FAT32_IMPORT_gpt;
+
+/**
+ * \brief Options for a scan.
+ */
+typedef struct scan_options scan_options;
+
+struct scan_options
+{
+    size_t threads;
+    /* the index of the first path argument, or argc to read standard input. */
+    int first_path;
+};
+
+/**
+ * \brief A growable list of paths.
+ */
+typedef struct path_list path_list;
+
+struct path_list
+{
+    char** paths;
+    size_t count;
+    size_t capacity;
+};
+
+/* forward decls. */
+static int parse_options(scan_options* options, int argc, char* argv[]);
+static void usage(const char* name);
+static int read_paths(path_list* list, FILE* in);
+static int append_path(path_list* list, char* path);
+static void emit_result(const char* path, const gpt_scan_result* result);
+static double now(void);
+
+/* the name of each probe classification. */
+static const char* const probe_names[] = {
+    "bad-size", "no-mbr", "legacy-mbr", "no-header", "gpt" };
+
+/* the name of each partition type. */
+static const char* const type_names[] = {
+    "unknown", "unused", "efi-system", "legacy-mbr", "bios-boot",
+    "microsoft-reserved", "microsoft-basic-data", "microsoft-ldm-metadata",
+    "microsoft-ldm-data", "windows-recovery", "linux-filesystem",
+    "linux-swap", "linux-lvm", "linux-raid", "linux-home", "linux-srv",
+    "linux-var", "linux-root-x86-64", "linux-root-arm64", "linux-usr-x86-64",
+    "linux-usr-arm64", "linux-xbootldr", "apple-hfs-plus", "apple-apfs",
+    "freebsd-ufs", "chromeos-kernel", "chromeos-rootfs" };
+
+/* a partition type without a name would be printed as NULL. */
+_Static_assert(
+    sizeof(type_names) / sizeof(type_names[0])
+        == FAT32_GPT_PARTITION_TYPE_COUNT,
+    "every partition type must have a name");
+
+/**
+ * \brief Entry point for the image scanner.
+ *
+ * \note Options are --threads=COUNT, where 0, the default, uses one worker
+ * per CPU.
+ *
+ * \param argc      Argument count.
+ * \param argv      Argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    int retval;
+    scan_options options;
+    path_list list = { NULL, 0, 0 };
+    gpt_scan_result* results = NULL;
+    size_t classes[FAT32_GPT_PROBE_GPT + 1] = { 0 };
+    size_t errors = 0;
+
+    if (0 != parse_options(&options, argc, argv))
+    {
+        return 1;
+    }
+
+    /* collect the paths. */
+    if (options.first_path < argc)
+    {
+        for (int i = options.first_path; i < argc; ++i)
+        {
+            if (0 != append_path(&list, argv[i]))
+            {
+                fprintf(stderr, "Could not allocate the path list.\n");
+                retval = 2;
+                goto done;
+            }
+        }
+    }
+    else if (0 != read_paths(&list, stdin))
+    {
+        fprintf(stderr, "Could not read the path list.\n");
+        retval = 2;
+        goto done;
+    }
+
+    results = (gpt_scan_result*)calloc(list.count + 1, sizeof(*results));
+    if (NULL == results)
+    {
+        fprintf(stderr, "Could not allocate the results.\n");
+        retval = 2;
+        goto done;
+    }
+
+    double start = now();
+    if (
+        STATUS_SUCCESS
+            != gpt_scan_images(
+                    results, (const char* const*)list.paths, list.count,
+                    options.threads))
+    {
+        fprintf(stderr, "Could not start the scan.\n");
+        retval = 2;
+        goto done;
+    }
+
+    double elapsed = now() - start;
+
+    for (size_t i = 0; i < list.count; ++i)
+    {
+        emit_result(list.paths[i], results + i);
+
+        if (STATUS_SUCCESS != results[i].status)
+        {
+            ++errors;
+        }
+        else
+        {
+            ++classes[results[i].probe];
+        }
+    }
+
+    fprintf(stderr, "%zu images in %.3f s:", list.count, elapsed);
+    for (size_t i = 0; i <= FAT32_GPT_PROBE_GPT; ++i)
+    {
+        fprintf(stderr, " %s=%zu", probe_names[i], classes[i]);
+    }
+
+    fprintf(stderr, " errors=%zu\n", errors);
+
+    retval = 0;
+    goto done;
+
+done:
+    /* paths from standard input are owned by the list. */
+    if (options.first_path >= argc)
+    {
+        for (size_t i = 0; i < list.count; ++i)
+        {
+            free(list.paths[i]);
+        }
+    }
+
+    free(list.paths);
+    free(results);
+
+    return retval;
+}
+
+/**
+ * \brief Parse the command line options.
+ *
+ * \param options   The options to fill.
+ * \param argc      Argument count.
+ * \param argv      Argument vector.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int parse_options(scan_options* options, int argc, char* argv[])
+{
+    options->threads = 0;
+    options->first_path = argc;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strncmp(argv[i], "--threads=", 10))
+        {
+            char* end;
+
+            /* reject anything but a whole non-negative count. */
+            errno = 0;
+            unsigned long long threads = strtoull(argv[i] + 10, &end, 0);
+            if (
+                !isdigit((unsigned char)argv[i][10]) || '\0' != *end
+             || 0 != errno || threads > SIZE_MAX)
+            {
+                usage(argv[0]);
+                return 1;
+            }
+
+            options->threads = (size_t)threads;
+        }
+        else if (0 == strcmp(argv[i], "--"))
+        {
+            options->first_path = i + 1;
+            break;
+        }
+        else if (0 == strncmp(argv[i], "--", 2))
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        else
+        {
+            options->first_path = i;
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Print the usage of this tool.
+ *
+ * \param name      The name of this tool.
+ */
+static void usage(const char* name)
+{
+    fprintf(stderr, "Usage: %s [--threads=COUNT] [--] [PATH...]\n", name);
+}
+
+/**
+ * \brief Read one path per line, skipping empty lines.
+ *
+ * \param list      The list to append to.
+ * \param in        The stream to read.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int read_paths(path_list* list, FILE* in)
+{
+    char* line = NULL;
+    size_t line_size = 0;
+    ssize_t length;
+
+    while ((length = getline(&line, &line_size, in)) >= 0)
+    {
+        if (length > 0 && '\n' == line[length - 1])
+        {
+            line[--length] = 0;
+        }
+
+        if (0 == length)
+        {
+            continue;
+        }
+
+        char* path = strdup(line);
+        if (NULL == path || 0 != append_path(list, path))
+        {
+            free(path);
+            free(line);
+            return 1;
+        }
+    }
+
+    free(line);
+
+    return ferror(in) ? 1 : 0;
+}
+
+/**
+ * \brief Append a path to a list, growing it as needed.
+ *
+ * \param list      The list to append to.
+ * \param path      The path to append.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int append_path(path_list* list, char* path)
+{
+    if (list->count == list->capacity)
+    {
+        size_t capacity = list->capacity > 0 ? list->capacity * 2 : 1024;
+        char** paths =
+            (char**)realloc(list->paths, capacity * sizeof(*paths));
+        if (NULL == paths)
+        {
+            return 1;
+        }
+
+        list->paths = paths;
+        list->capacity = capacity;
+    }
+
+    list->paths[list->count++] = path;
+
+    return 0;
+}
+
+/**
+ * \brief Write the result of one image as a tab-separated line.
+ *
+ * \note The columns are the path, the classification or "error", the status,
+ * the number of partitions in use, and the comma-separated partition types.
+ *
+ * \param path      The path of the image.
+ * \param result    The result of the image.
+ */
+static void emit_result(const char* path, const gpt_scan_result* result)
+{
+    const char* separator = "";
+
+    printf(
+        "%s\t%s\t%d\t%u\t", path,
+        STATUS_SUCCESS == result->status ? probe_names[result->probe] : "error",
+        result->status, result->partition_count);
+
+    for (int i = 0; i < FAT32_GPT_PARTITION_TYPE_COUNT; ++i)
+    {
+        if (result->partition_type_mask & (UINT32_C(1) << i))
+        {
+            printf("%s%s", separator, type_names[i]);
+            separator = ",";
+        }
+    }
+
+    printf("\n");
+}
+
+/**
+ * \brief Get the monotonic time in seconds.
+ *
+ * \returns the time.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}